@@ -0,0 +1,125 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "eminline.h"
+#include "attotime.h"
+#include "timerheap.h"
+
+#include <algorithm>
+#include <vector>
+
+// Models the scheduler's periodic timer workload: the earliest timer fires
+// and is rescheduled one period later, as emu_timer::schedule_next_period()
+// does.  The sorted list copies the previous device_scheduler behaviour for
+// comparison; the heap case runs the timer_heap the scheduler uses today,
+// since emu_timer itself can't be built without a running machine.
+
+namespace {
+
+struct bench_timer
+{
+	bench_timer *next = nullptr;
+	bench_timer *prev = nullptr;
+	u32 heap_index = 0;
+	u64 sequence = 0;
+	attotime expire;
+	attotime period;
+};
+
+class sorted_list_queue
+{
+public:
+	bench_timer *first() const { return m_head; }
+
+	void insert(bench_timer &timer)
+	{
+		bench_timer *prevtimer = nullptr;
+		for (bench_timer *curtimer = m_head; curtimer != nullptr; prevtimer = curtimer, curtimer = curtimer->next)
+		{
+			if (curtimer->expire > timer.expire)
+			{
+				timer.prev = prevtimer;
+				timer.next = curtimer;
+				if (prevtimer != nullptr)
+					prevtimer->next = &timer;
+				else
+					m_head = &timer;
+				curtimer->prev = &timer;
+				return;
+			}
+		}
+		if (prevtimer != nullptr)
+			prevtimer->next = &timer;
+		else
+			m_head = &timer;
+		timer.prev = prevtimer;
+		timer.next = nullptr;
+	}
+
+	void remove(bench_timer &timer)
+	{
+		if (timer.prev != nullptr)
+			timer.prev->next = timer.next;
+		else
+			m_head = timer.next;
+		if (timer.next != nullptr)
+			timer.next->prev = timer.prev;
+	}
+
+private:
+	bench_timer *m_head = nullptr;
+};
+
+// device_scheduler's own heap, ordered the way it orders emu_timers
+struct bench_timer_traits
+{
+	static bool precedes(const bench_timer &a, const bench_timer &b) { return (a.expire < b.expire) || ((a.expire == b.expire) && (a.sequence < b.sequence)); }
+	static u32 &heap_index(bench_timer &timer) { return timer.heap_index; }
+};
+
+class binary_heap_queue
+{
+public:
+	bench_timer *first() const { return m_heap.front(); }
+
+	void insert(bench_timer &timer)
+	{
+		timer.sequence = m_sequence++;
+		m_heap.insert(timer);
+	}
+
+	void remove(bench_timer &timer) { m_heap.remove(timer); }
+
+private:
+	timer_heap<bench_timer, bench_timer_traits> m_heap;
+	u64 m_sequence = 0;
+};
+
+template <typename Queue>
+void run_periodic_timers(benchmark::State &state)
+{
+	// a spread of periods like serial clocks, scanline timers and sound chips
+	std::vector<bench_timer> timers(state.range(0));
+	Queue queue;
+	for (size_t i = 0; i < timers.size(); i++)
+	{
+		timers[i].period = attotime::from_hz(u32(1000 + (i * 7919) % 100000));
+		timers[i].expire = timers[i].period;
+		queue.insert(timers[i]);
+	}
+
+	while (state.KeepRunning())
+	{
+		bench_timer &timer = *queue.first();
+		queue.remove(timer);
+		timer.expire += timer.period;
+		queue.insert(timer);
+	}
+}
+
+void BM_timer_sorted_list(benchmark::State &state) { run_periodic_timers<sorted_list_queue>(state); }
+void BM_timer_binary_heap(benchmark::State &state) { run_periodic_timers<binary_heap_queue>(state); }
+
+} // anonymous namespace
+
+BENCHMARK(BM_timer_sorted_list)->Range(8, 1024);
+BENCHMARK(BM_timer_binary_heap)->Range(8, 1024);
@@ -0,0 +1,47 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "bitmap.h"
+#include "hash.h"
+
+#include <vector>
+
+// Core utility routines that show up in ROM loading, auditing and every
+// driver's screen update.
+
+namespace {
+
+void BM_hash_crc_sha1(benchmark::State &state)
+{
+	std::vector<uint8_t> data(state.range(0));
+	for (size_t i = 0; i < data.size(); i++)
+		data[i] = uint8_t(i * 0x9d);
+
+	util::hash_collection hashes;
+	while (state.KeepRunning())
+		hashes.compute(&data[0], data.size(), util::hash_collection::HASH_TYPES_CRC_SHA1);
+	state.SetBytesProcessed(int64_t(state.iterations()) * data.size());
+}
+
+void BM_bitmap_fill_full(benchmark::State &state)
+{
+	bitmap_ind16 bitmap(state.range(0), state.range(0) * 3 / 4);
+	while (state.KeepRunning())
+		bitmap.fill(0);
+	state.SetBytesProcessed(int64_t(state.iterations()) * bitmap.rowbytes() * bitmap.height());
+}
+
+void BM_bitmap_fill_clipped(benchmark::State &state)
+{
+	// a visible area inset from the allocated bitmap, as with most screens
+	bitmap_ind16 bitmap(state.range(0), state.range(0) * 3 / 4);
+	rectangle const clip(8, bitmap.width() - 9, 8, bitmap.height() - 9);
+	while (state.KeepRunning())
+		bitmap.fill(0, clip);
+	state.SetBytesProcessed(int64_t(state.iterations()) * clip.width() * clip.height() * sizeof(uint16_t));
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_hash_crc_sha1)->Range(4096, 16 << 20);
+BENCHMARK(BM_bitmap_fill_full)->Range(320, 2048);
+BENCHMARK(BM_bitmap_fill_clipped)->Range(320, 2048);
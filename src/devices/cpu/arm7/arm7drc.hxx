@@ -212,7 +212,10 @@ void arm7_cpu_device::execute_run_drc()
 
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
+		{
+			drcuml.note_missing_code();
 			code_compile_block(m_impstate.mode, m_r[eR15]);
+		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
 			fatalerror("Attempted to execute unmapped code at PC=%08X\n", m_r[eR15]);
 		else if (execute_result == EXECUTE_RESET_CACHE)
@@ -11,6 +11,8 @@
 #include "emu.h"
 #include "drccache.h"
 
+#include "emuopts.h"
+
 #include <algorithm>
 
 
@@ -49,7 +51,9 @@ drc_cache::drc_cache(size_t bytes) :
 	m_codegen(nullptr),
 	m_size(m_cache.size()),
 	m_executable(false),
-	m_rwx(false)
+	m_rwx(false),
+	m_peak(0),
+	m_flushes(0)
 {
 	// alignment and page size must be powers of two, cache must be page-aligned
 	assert(!(CACHE_ALIGNMENT & (CACHE_ALIGNMENT - 1)));
@@ -90,6 +94,19 @@ drc_cache::~drc_cache()
 }
 
 
+//-------------------------------------------------
+//  configured_size - return the size to allocate
+//  for a cache, honoring the drc_cache_size
+//  option
+//-------------------------------------------------
+
+size_t drc_cache::configured_size(emu_options const &options, size_t bytes)
+{
+	int const megabytes = options.drc_cache_size();
+	return (megabytes > 0) ? (size_t(megabytes) << 20) : bytes;
+}
+
+
 
 //-------------------------------------------------
 //  flush - flush the cache contents
@@ -101,6 +118,9 @@ void drc_cache::flush()
 	assert(!m_codegen);
 
 	// just reset the top back to the base and re-seed
+	if (m_top != m_base)
+		m_flushes++;
+	m_peak = std::max<size_t>(m_peak, m_top - m_base);
 	m_top = m_base;
 	codegen_init();
 }
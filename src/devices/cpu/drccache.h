@@ -45,6 +45,9 @@ public:
 	drc_cache(size_t bytes);
 	~drc_cache();
 
+	// size to use for a cache, honoring any user override
+	static size_t configured_size(emu_options const &options, size_t bytes);
+
 	// getters
 	drccodeptr near() const { return m_near; }
 	drccodeptr base() const { return m_base; }
@@ -55,6 +58,11 @@ public:
 	bool contains_near_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_neartop); }
 	bool generating_code() const { return (m_codegen != nullptr); }
 
+	// statistics
+	size_t size() const { return m_size; }
+	size_t peak() const { return std::max<size_t>(m_peak, m_top - m_base); }
+	uint32_t flushes() const { return m_flushes; }
+
 	// memory management
 	void flush();
 	void *alloc(size_t bytes);
@@ -95,6 +103,8 @@ private:
 	size_t const        m_size;             // size of the cache in bytes
 	bool                m_executable;       // whether cached code is currently executable
 	bool                m_rwx;              // whether pages can be simultaneously writable and executable
+	size_t              m_peak;             // most code and temporary memory in use before a flush
+	uint32_t            m_flushes;          // number of times the cache has been flushed
 
 	// oob management
 	struct oob_handler
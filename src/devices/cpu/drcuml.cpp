@@ -35,12 +35,15 @@
 #include "drcuml.h"
 
 #include "emuopts.h"
+#include "corestr.h"
 #include "drcbec.h"
 #ifdef NATIVE_DRC
 #include "drcbex86.h"
 #include "drcbex64.h"
 #endif
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 
 
@@ -77,6 +80,91 @@ struct bevalidate_test
 };
 
 
+namespace {
+
+// persistent translation cache file format
+constexpr char const *PERSIST_MAGIC   = "MAMEDRC";
+constexpr u32 PERSIST_VERSION         = 2;
+constexpr u32 PERSIST_HOST            = 0x01020304 ^ sizeof(void *);
+
+// serializes persisted blocks in host byte order
+class persist_writer
+{
+public:
+	template <typename T> void put(T value)
+	{
+		u8 const *const src(reinterpret_cast<u8 const *>(&value));
+		m_data.insert(m_data.end(), src, src + sizeof(T));
+	}
+	void put_string(std::string const &str)
+	{
+		put<u16>(str.length());
+		m_data.insert(m_data.end(), str.begin(), str.end());
+	}
+	void put_bytes(std::vector<u8> const &bytes)
+	{
+		put<u32>(bytes.size());
+		m_data.insert(m_data.end(), bytes.begin(), bytes.end());
+	}
+	std::vector<u8> const &data() const { return m_data; }
+
+private:
+	std::vector<u8> m_data;
+};
+
+// reads back persisted blocks, tracking overruns
+class persist_reader
+{
+public:
+	persist_reader(std::vector<u8> const &data) : m_data(data), m_offset(0), m_ok(true) { }
+
+	template <typename T> T get()
+	{
+		T value{};
+		if (check(sizeof(T)))
+		{
+			memcpy(&value, &m_data[m_offset], sizeof(T));
+			m_offset += sizeof(T);
+		}
+		return value;
+	}
+	std::string get_string()
+	{
+		u16 const length(get<u16>());
+		if (!check(length))
+			return std::string();
+		std::string const result(reinterpret_cast<char const *>(&m_data[m_offset]), length);
+		m_offset += length;
+		return result;
+	}
+	void get_bytes(std::vector<u8> &bytes)
+	{
+		u32 const length(get<u32>());
+		if (check(length))
+		{
+			bytes.assign(m_data.begin() + m_offset, m_data.begin() + m_offset + length);
+			m_offset += length;
+		}
+	}
+	bool ok() const { return m_ok; }
+
+private:
+	bool check(size_t length)
+	{
+		if (m_ok && (length <= (m_data.size() - m_offset)))
+			return true;
+		m_ok = false;
+		return false;
+	}
+
+	std::vector<u8> const &m_data;
+	size_t m_offset;
+	bool m_ok;
+};
+
+} // anonymous namespace
+
+
 
 //**************************************************************************
 //  DRC BACKEND INTERFACE
@@ -148,7 +236,31 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
+	, m_optimize_before(0)
+	, m_optimize_after(0)
+	, m_blocks_compiled(0)
+	, m_blocks_aborted(0)
+	, m_missing_code(0)
+	, m_persist_enabled(device.machine().options().drc_persist())
+	, m_persist_pending(false)
+	, m_persist_key(0)
+	, m_persist_romcrc(0)
+	, m_persist_loaded(0)
+	, m_persist_reused(0)
 {
+	if (m_persist_enabled)
+	{
+		// all memory regions and shares are relocatable by tag
+		for (auto const &region : device.machine().memory().regions())
+			persist_memory(region.second->base(), region.second->bytes(), ("region" + region.first).c_str());
+		for (auto const &share : device.machine().memory().shares())
+			persist_memory(share.second->ptr(), share.second->bytes(), ("share" + share.first).c_str());
+
+		// pick up translations from the last run, and write them back out on exit
+		m_persist_romcrc = persist_rom_checksum();
+		persist_load();
+		device.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drcuml_state::persist_save, this));
+	}
 }
 
 
@@ -158,6 +270,10 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 
 drcuml_state::~drcuml_state()
 {
+	if (m_optimize_before)
+		osd_printf_verbose("%s: UML optimizer kept %u of %u instructions (%.1f%%)\n", m_device.tag(), m_optimize_after, m_optimize_before, 100.0 * double(m_optimize_after) / double(m_optimize_before));
+	osd_printf_verbose("%s: DRC cache %u KB, peak use %u KB, %u flushes, %u misses, %u blocks compiled, %u aborted\n",
+			m_device.tag(), m_cache.size() >> 10, m_cache.peak() >> 10, m_cache.flushes(), m_missing_code, m_blocks_compiled, m_blocks_aborted);
 }
 
 
@@ -219,6 +335,9 @@ drcuml_block &drcuml_state::begin_block(uint32_t maxinst)
 	if (!bestblock)
 		bestblock = &*m_blocklist.emplace(m_blocklist.end(), *this, maxinst * 3 / 2);
 
+	// only blocks announced with persist_begin are captured
+	m_persist_pending = false;
+
 	// start the block
 	bestblock->begin();
 	return *bestblock;
@@ -292,6 +411,568 @@ void drcuml_state::log_vprintf(util::format_argument_pack<std::ostream> const &a
 
 
 
+//-------------------------------------------------
+//  persist_memory - register memory that blocks
+//  may reference, so it can be relocated by name
+//  in a later run
+//-------------------------------------------------
+
+void drcuml_state::persist_memory(void const *base, size_t length, char const *name)
+{
+	if (!m_persist_enabled || !base || !length)
+		return;
+
+	persist_symbol &symbol(m_persist_symbols[persist_symbol_index(name)]);
+	symbol.memory = reinterpret_cast<u8 const *>(base);
+	symbol.length = length;
+}
+
+
+//-------------------------------------------------
+//  persist_function - register a C function that
+//  blocks may call, so it can be relocated by name
+//  in a later run
+//-------------------------------------------------
+
+void drcuml_state::persist_function(uml::c_function func, char const *name)
+{
+	if (m_persist_enabled)
+		m_persist_symbols[persist_symbol_index(name)].func = func;
+}
+
+
+//-------------------------------------------------
+//  persist_begin - note the mode and PC of the
+//  block about to be generated so it can be
+//  captured when it ends
+//-------------------------------------------------
+
+void drcuml_state::persist_begin(u32 mode, offs_t pc)
+{
+	m_persist_pending = m_persist_enabled;
+	m_persist_key = (u64(mode) << 32) | pc;
+	m_persist_spans.clear();
+}
+
+
+//-------------------------------------------------
+//  persist_add_code - record an instruction the
+//  block being generated was translated from
+//-------------------------------------------------
+
+void drcuml_state::persist_add_code(offs_t pc, offs_t physpc, u32 length)
+{
+	if (!m_persist_pending)
+		return;
+
+	// only code fetched directly from memory can be checked in a later run
+	persist_span &span(m_persist_spans.emplace_back());
+	span.pc = pc;
+	span.physpc = physpc;
+	span.length = length;
+	offs_t translated(pc);
+	if (!m_device.memory().translate(AS_PROGRAM, TRANSLATE_FETCH, translated) || (translated != physpc) || !persist_read_code(physpc, length, span.bytes))
+		m_persist_pending = false;
+}
+
+
+//-------------------------------------------------
+//  persist_capture - save the unoptimized UML for
+//  the block announced by persist_begin
+//-------------------------------------------------
+
+void drcuml_state::persist_capture(uml::instruction const *inst, u32 count)
+{
+	if (!m_persist_pending || m_persist_spans.empty())
+		return;
+	m_persist_pending = false;
+
+	persist_block block;
+	block.insts.reserve(count);
+	for (u32 index = 0; index < count; index++)
+	{
+		// comments only exist for logging, and point to temporary memory
+		uml::instruction const &cur(inst[index]);
+		if (cur.opcode() == uml::OP_COMMENT)
+			continue;
+
+		persist_inst &saved(block.insts.emplace_back());
+		saved.opcode = cur.opcode();
+		saved.size = cur.size();
+		saved.condition = cur.condition();
+		saved.numparams = cur.numparams();
+		for (int pnum = 0; pnum < cur.numparams(); pnum++)
+			if (!persist_encode(cur.param(pnum), saved.param[pnum]))
+				return;
+	}
+	block.spans = std::move(m_persist_spans);
+	m_persist_blocks[m_persist_key] = std::move(block);
+}
+
+
+//-------------------------------------------------
+//  persist_replay - generate a block from the
+//  persisted UML for the given mode and PC if the
+//  code it was translated from is unchanged
+//-------------------------------------------------
+
+bool drcuml_state::persist_replay(u32 mode, offs_t pc)
+{
+	if (!m_persist_enabled)
+		return false;
+	auto const found(m_persist_blocks.find((u64(mode) << 32) | pc));
+	if (found == m_persist_blocks.end())
+		return false;
+	persist_block const &saved(found->second);
+
+	// every instruction must translate to the same place and hold the same opcode
+	std::vector<u8> bytes;
+	for (persist_span const &span : saved.spans)
+	{
+		offs_t translated(span.pc);
+		if (!m_device.memory().translate(AS_PROGRAM, TRANSLATE_FETCH, translated) || (translated != span.physpc))
+			return false;
+		if (!persist_read_code(span.physpc, span.length, bytes) || (bytes != span.bytes))
+			return false;
+	}
+
+	// relocate everything before touching the cache
+	std::vector<uml::instruction> insts(saved.insts.size());
+	for (size_t index = 0; index < insts.size(); index++)
+	{
+		persist_inst const &cur(saved.insts[index]);
+		uml::parameter params[uml::instruction::MAX_PARAMS];
+		for (int pnum = 0; pnum < cur.numparams; pnum++)
+			if (!persist_decode(cur.param[pnum], params[pnum]))
+				return false;
+		insts[index].reconstruct(uml::opcode_t(cur.opcode), cur.size, uml::condition_t(cur.condition), cur.numparams, params);
+	}
+	if (insts.empty())
+		return false;
+
+	// feed it through the normal path; this may throw if the cache fills
+	drcuml_block &block(begin_block(insts.size()));
+	for (uml::instruction const &inst : insts)
+		block.append() = inst;
+	block.end();
+	m_persist_reused++;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  persist_symbol_index - find or add a symbol by
+//  name
+//-------------------------------------------------
+
+u16 drcuml_state::persist_symbol_index(std::string const &name)
+{
+	auto const found(m_persist_names.find(name));
+	if (found != m_persist_names.end())
+		return found->second;
+
+	u16 const index(m_persist_symbols.size());
+	m_persist_symbols.emplace_back().name = name;
+	m_persist_names.emplace(name, index);
+	return index;
+}
+
+
+//-------------------------------------------------
+//  persist_read_code - copy the memory around an
+//  instruction in whole 64-bit lanes, so byte
+//  swizzling within a bus word doesn't matter
+//-------------------------------------------------
+
+bool drcuml_state::persist_read_code(offs_t physpc, u32 length, std::vector<u8> &bytes) const
+{
+	offs_t const start(physpc & ~offs_t(7));
+	offs_t const end((physpc + length + 7) & ~offs_t(7));
+	if (end <= start)
+		return false;
+
+	// the whole range must be directly readable and contiguous
+	address_space &space(m_device.memory().space(AS_PROGRAM));
+	u8 const *const base(reinterpret_cast<u8 const *>(space.get_read_ptr(start)));
+	if (!base || (reinterpret_cast<u8 const *>(space.get_read_ptr(end - 8)) != (base + (end - 8 - start))))
+		return false;
+
+	bytes.assign(base, base + (end - start));
+	return true;
+}
+
+
+//-------------------------------------------------
+//  persist_encode - convert a parameter to its
+//  relocatable form
+//-------------------------------------------------
+
+bool drcuml_state::persist_encode(uml::parameter const &param, persist_param &result)
+{
+	result.type = param.type();
+	result.symbol = 0;
+	result.value = 0;
+	switch (param.type())
+	{
+	case uml::parameter::PTYPE_NONE:                                                break;
+	case uml::parameter::PTYPE_IMMEDIATE:       result.value = param.immediate();   break;
+	case uml::parameter::PTYPE_INT_REGISTER:    result.value = param.ireg();        break;
+	case uml::parameter::PTYPE_FLOAT_REGISTER:  result.value = param.freg();        break;
+	case uml::parameter::PTYPE_VECTOR_REGISTER: result.value = param.vreg();        break;
+	case uml::parameter::PTYPE_MAPVAR:          result.value = param.mapvar();      break;
+	case uml::parameter::PTYPE_SIZE:            result.value = param.size();        break;
+	case uml::parameter::PTYPE_SIZE_SCALE:      result.value = (param.scale() << 4) | param.size(); break;
+	case uml::parameter::PTYPE_SIZE_SPACE:      result.value = (param.space() << 4) | param.size(); break;
+	case uml::parameter::PTYPE_CODE_LABEL:      result.value = param.label();       break;
+	case uml::parameter::PTYPE_ROUNDING:        result.value = param.rounding();    break;
+
+	case uml::parameter::PTYPE_MEMORY:
+		{
+			u8 const *const ptr(reinterpret_cast<u8 const *>(param.memory()));
+			for (size_t index = 0; index < m_persist_symbols.size(); index++)
+			{
+				persist_symbol const &symbol(m_persist_symbols[index]);
+				if (symbol.memory && (ptr >= symbol.memory) && (ptr < (symbol.memory + symbol.length)))
+				{
+					result.symbol = index;
+					result.value = ptr - symbol.memory;
+					return true;
+				}
+			}
+			return false;
+		}
+
+	case uml::parameter::PTYPE_C_FUNCTION:
+		for (size_t index = 0; index < m_persist_symbols.size(); index++)
+		{
+			if (m_persist_symbols[index].func == param.cfunc())
+			{
+				result.symbol = index;
+				return true;
+			}
+		}
+		return false;
+
+	case uml::parameter::PTYPE_CODE_HANDLE:
+		{
+			// handles are matched by name; refuse to guess if two share one
+			result.symbol = persist_symbol_index(std::string("handle:") + param.handle().string());
+			persist_symbol &symbol(m_persist_symbols[result.symbol]);
+			if (symbol.handle && (symbol.handle != &param.handle()))
+				return false;
+			symbol.handle = &param.handle();
+			return true;
+		}
+
+	default:
+		return false;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  persist_decode - convert a relocatable
+//  parameter back to a live one
+//-------------------------------------------------
+
+bool drcuml_state::persist_decode(persist_param const &param, uml::parameter &result)
+{
+	switch (param.type)
+	{
+	case uml::parameter::PTYPE_NONE:
+		result = uml::parameter();
+		return true;
+
+	case uml::parameter::PTYPE_IMMEDIATE:
+		result = uml::parameter(param.value);
+		return true;
+
+	case uml::parameter::PTYPE_INT_REGISTER:
+		if ((param.value < uml::REG_I0) || (param.value >= uml::REG_I_END))
+			return false;
+		result = uml::parameter::make_ireg(param.value);
+		return true;
+
+	case uml::parameter::PTYPE_FLOAT_REGISTER:
+		if ((param.value < uml::REG_F0) || (param.value >= uml::REG_F_END))
+			return false;
+		result = uml::parameter::make_freg(param.value);
+		return true;
+
+	case uml::parameter::PTYPE_VECTOR_REGISTER:
+		if ((param.value < uml::REG_V0) || (param.value >= uml::REG_V_END))
+			return false;
+		result = uml::parameter::make_vreg(param.value);
+		return true;
+
+	case uml::parameter::PTYPE_MAPVAR:
+		if ((param.value < uml::MAPVAR_M0) || (param.value >= uml::MAPVAR_END))
+			return false;
+		result = uml::parameter::make_mapvar(param.value);
+		return true;
+
+	case uml::parameter::PTYPE_SIZE:
+		if (param.value > uml::SIZE_DQWORD)
+			return false;
+		result = uml::parameter::make_size(uml::operand_size(param.value));
+		return true;
+
+	case uml::parameter::PTYPE_SIZE_SCALE:
+		if (((param.value & 15) > uml::SIZE_DQWORD) || ((param.value >> 4) > uml::SCALE_x8))
+			return false;
+		result = uml::parameter(uml::operand_size(param.value & 15), uml::memory_scale(param.value >> 4));
+		return true;
+
+	case uml::parameter::PTYPE_SIZE_SPACE:
+		if (((param.value & 15) > uml::SIZE_DQWORD) || ((param.value >> 4) > uml::SPACE_IO))
+			return false;
+		result = uml::parameter(uml::operand_size(param.value & 15), uml::memory_space(param.value >> 4));
+		return true;
+
+	case uml::parameter::PTYPE_CODE_LABEL:
+		result = uml::parameter(uml::code_label(u32(param.value)));
+		return true;
+
+	case uml::parameter::PTYPE_ROUNDING:
+		if (param.value > uml::ROUND_DEFAULT)
+			return false;
+		result = uml::parameter::make_rounding(uml::float_rounding_mode(param.value));
+		return true;
+
+	default:
+		break;
+	}
+
+	// everything else is relocated through a symbol
+	if (param.symbol >= m_persist_symbols.size())
+		return false;
+	persist_symbol &symbol(m_persist_symbols[param.symbol]);
+	switch (param.type)
+	{
+	case uml::parameter::PTYPE_MEMORY:
+		if (!symbol.memory || (param.value >= symbol.length))
+			return false;
+		result = uml::parameter::make_memory(symbol.memory + param.value);
+		return true;
+
+	case uml::parameter::PTYPE_C_FUNCTION:
+		if (!symbol.func)
+			return false;
+		result = uml::parameter::make_cfunc(symbol.func);
+		return true;
+
+	case uml::parameter::PTYPE_CODE_HANDLE:
+		if (!symbol.handle)
+		{
+			// resolve by name the first time; the name must be unique
+			for (uml::code_handle &handle : m_handlelist)
+			{
+				if (symbol.name.compare(0, 7, "handle:") || (symbol.name.compare(7, std::string::npos, handle.string())))
+					continue;
+				if (symbol.handle)
+				{
+					symbol.handle = nullptr;
+					return false;
+				}
+				symbol.handle = &handle;
+			}
+			if (!symbol.handle)
+				return false;
+		}
+		result = uml::parameter(*symbol.handle);
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+
+//-------------------------------------------------
+//  persist_rom_checksum - checksum the contents
+//  of all memory regions
+//-------------------------------------------------
+
+u32 drcuml_state::persist_rom_checksum() const
+{
+	// sort by tag so the result doesn't depend on hash map ordering
+	std::vector<memory_region *> regions;
+	for (auto const &region : m_device.machine().memory().regions())
+		regions.push_back(region.second.get());
+	std::sort(regions.begin(), regions.end(), [] (memory_region const *a, memory_region const *b) { return a->name() < b->name(); });
+
+	util::crc32_creator crc;
+	for (memory_region *region : regions)
+	{
+		crc.append(region->name().c_str(), region->name().length());
+		if (region->bytes())
+			crc.append(region->base(), region->bytes());
+	}
+	return crc.finish();
+}
+
+
+//-------------------------------------------------
+//  persist_filename - get the name of the file
+//  holding persisted blocks for this device
+//-------------------------------------------------
+
+std::string drcuml_state::persist_filename() const
+{
+	std::string tag(m_device.tag());
+	tag.erase(0, 1);
+	strreplacechr(tag, ':', '_');
+	return std::string(m_device.machine().basename()) + PATH_SEPARATOR + tag + ".drc";
+}
+
+
+//-------------------------------------------------
+//  persist_load - read blocks persisted by an
+//  earlier run of the same build and ROM set
+//-------------------------------------------------
+
+void drcuml_state::persist_load()
+{
+	emu_file file(m_device.machine().options().drc_cache_directory(), OPEN_FLAG_READ);
+	if (file.open(persist_filename()) != osd_file::error::NONE)
+		return;
+
+	// the whole file is compressed; read until it runs dry
+	std::vector<u8> data;
+	file.compress(FCOMPRESS_MEDIUM);
+	for (u32 actual = 1; actual; )
+	{
+		size_t const offset(data.size());
+		data.resize(offset + 0x10000);
+		actual = file.read(&data[offset], 0x10000);
+		data.resize(offset + actual);
+	}
+
+	// discard everything unless the header matches this build, host and ROM set
+	persist_reader reader(data);
+	if ((reader.get_string() != PERSIST_MAGIC) || (reader.get<u32>() != PERSIST_VERSION) || (reader.get<u32>() != PERSIST_HOST))
+		return;
+	if ((reader.get_string() != emulator_info::get_build_version()) || (reader.get<u32>() != m_persist_romcrc))
+		return;
+	if (reader.get<u8>() != ((m_device.machine().debug_flags & DEBUG_FLAG_ENABLED) ? 1 : 0))
+		return;
+
+	// symbol indices in the file are remapped to ours
+	std::vector<u16> remap(reader.get<u32>());
+	for (u16 &index : remap)
+	{
+		std::string const name(reader.get_string());
+		if (!reader.ok())
+			return;
+		index = persist_symbol_index(name);
+	}
+
+	std::unordered_map<u64, persist_block> blocks;
+	for (u32 count = reader.get<u32>(); reader.ok() && count; count--)
+	{
+		u64 const key(reader.get<u64>());
+		persist_block &block(blocks[key]);
+		block.spans.resize(std::min<u32>(reader.get<u32>(), data.size()));
+		for (persist_span &span : block.spans)
+		{
+			span.pc = reader.get<u32>();
+			span.physpc = reader.get<u32>();
+			span.length = reader.get<u32>();
+			reader.get_bytes(span.bytes);
+		}
+		block.insts.resize(std::min<u32>(reader.get<u32>(), data.size()));
+		for (persist_inst &inst : block.insts)
+		{
+			inst.opcode = reader.get<u8>();
+			inst.size = reader.get<u8>();
+			inst.condition = reader.get<u8>();
+			inst.numparams = reader.get<u8>();
+			if ((inst.opcode == uml::OP_INVALID) || (inst.opcode >= uml::OP_MAX) || (inst.numparams > uml::instruction::MAX_PARAMS))
+				return;
+			if ((inst.size != 1) && (inst.size != 2) && (inst.size != 4) && (inst.size != 8))
+				return;
+			for (int pnum = 0; pnum < inst.numparams; pnum++)
+			{
+				persist_param &param(inst.param[pnum]);
+				param.type = reader.get<u8>();
+				u16 const symbol(reader.get<u16>());
+				param.value = reader.get<u64>();
+				if ((param.type >= uml::parameter::PTYPE_MAX) || (param.type == uml::parameter::PTYPE_STRING) || (symbol >= remap.size()))
+					return;
+				param.symbol = remap[symbol];
+			}
+		}
+	}
+	if (!reader.ok())
+		return;
+
+	m_persist_loaded = blocks.size();
+	m_persist_blocks = std::move(blocks);
+}
+
+
+//-------------------------------------------------
+//  persist_save - write out all persisted blocks
+//  on exit
+//-------------------------------------------------
+
+void drcuml_state::persist_save()
+{
+	osd_printf_verbose("%s: %u DRC blocks loaded, %u reused, %u saved\n", m_device.tag(), m_persist_loaded, m_persist_reused, unsigned(m_persist_blocks.size()));
+	if (m_persist_blocks.empty())
+		return;
+
+	persist_writer writer;
+	writer.put_string(PERSIST_MAGIC);
+	writer.put<u32>(PERSIST_VERSION);
+	writer.put<u32>(PERSIST_HOST);
+	writer.put_string(emulator_info::get_build_version());
+	writer.put<u32>(m_persist_romcrc);
+	writer.put<u8>((m_device.machine().debug_flags & DEBUG_FLAG_ENABLED) ? 1 : 0);
+
+	writer.put<u32>(m_persist_symbols.size());
+	for (persist_symbol const &symbol : m_persist_symbols)
+		writer.put_string(symbol.name);
+
+	writer.put<u32>(m_persist_blocks.size());
+	for (auto const &entry : m_persist_blocks)
+	{
+		writer.put<u64>(entry.first);
+		writer.put<u32>(entry.second.spans.size());
+		for (persist_span const &span : entry.second.spans)
+		{
+			writer.put<u32>(span.pc);
+			writer.put<u32>(span.physpc);
+			writer.put<u32>(span.length);
+			writer.put_bytes(span.bytes);
+		}
+		writer.put<u32>(entry.second.insts.size());
+		for (persist_inst const &inst : entry.second.insts)
+		{
+			writer.put<u8>(inst.opcode);
+			writer.put<u8>(inst.size);
+			writer.put<u8>(inst.condition);
+			writer.put<u8>(inst.numparams);
+			for (int pnum = 0; pnum < inst.numparams; pnum++)
+			{
+				writer.put<u8>(inst.param[pnum].type);
+				writer.put<u16>(inst.param[pnum].symbol);
+				writer.put<u64>(inst.param[pnum].value);
+			}
+		}
+	}
+
+	emu_file file(m_device.machine().options().drc_cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(persist_filename()) == osd_file::error::NONE)
+	{
+		file.compress(FCOMPRESS_MEDIUM);
+		file.write(&writer.data()[0], writer.data().size());
+	}
+}
+
+
+
 //**************************************************************************
 //  DRCUML BLOCK
 //**************************************************************************
@@ -340,6 +1021,9 @@ void drcuml_block::end()
 {
 	assert(m_inuse);
 
+	// keep the unoptimized code if it's going to be persisted
+	m_drcuml.persist_capture(&m_inst[0], m_nextinst);
+
 	// optimize the resulting code first
 	optimize();
 
@@ -350,6 +1034,7 @@ void drcuml_block::end()
 	// generate the code via the back-end
 	m_drcuml.cache().codegen_init();
 	m_drcuml.generate(*this, &m_inst[0], m_nextinst);
+	m_drcuml.note_compiled();
 
 	// block is no longer in use
 	m_inuse = false;
@@ -366,6 +1051,7 @@ void drcuml_block::abort()
 
 	// block is no longer in use
 	m_inuse = false;
+	m_drcuml.note_aborted();
 
 	// unwind
 	throw abort_compilation();
@@ -431,6 +1117,321 @@ void drcuml_block::optimize()
 		// now that flags are correct, simplify the instruction
 		inst.simplify();
 	}
+
+	// then work across instructions
+	u32 const before(m_nextinst);
+	propagate_constants();
+	forward_memory();
+	remove_dead_code();
+	compact();
+	m_drcuml.note_optimized(before, m_nextinst);
+}
+
+
+//-------------------------------------------------
+//  propagate_constants - substitute integer
+//  registers holding known values with
+//  immediates and fold the results
+//-------------------------------------------------
+
+void drcuml_block::propagate_constants()
+{
+	// known register values; size 0 means unknown, 4 means only the low 32 bits are known
+	u64 value[uml::REG_I_COUNT];
+	u8 known[uml::REG_I_COUNT] = { 0 };
+
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+
+		switch (inst.opcode())
+		{
+		// anything can be live at an entry point, and handlers can change anything
+		case uml::OP_HANDLE:
+		case uml::OP_HASH:
+		case uml::OP_LABEL:
+		case uml::OP_CALLH:
+		case uml::OP_CALLC:
+		case uml::OP_EXH:
+		case uml::OP_RESTORE:
+			std::fill(std::begin(known), std::end(known), 0);
+			continue;
+
+		case uml::OP_COMMENT:
+		case uml::OP_MAPVAR:
+		case uml::OP_NOP:
+			continue;
+
+		default:
+			break;
+		}
+
+		// replace reads of known registers where an immediate is allowed
+		bool changed(false);
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			uml::parameter const &param(inst.param(pnum));
+			if (!param.is_int_register() || inst.param_is_output(pnum) || !inst.param_accepts(pnum, uml::parameter::PTYPE_IMMEDIATE))
+				continue;
+
+			int const reg(param.ireg() - uml::REG_I0);
+			u8 const size(inst.param_size(pnum));
+			if (known[reg] >= size)
+			{
+				inst.set_param(pnum, (size >= 8) ? value[reg] : (value[reg] & ((u64(1) << (size * 8)) - 1)));
+				changed = true;
+			}
+		}
+		if (changed)
+			inst.simplify();
+
+		// track what the instruction leaves in registers
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			uml::parameter const &param(inst.param(pnum));
+			if (!param.is_int_register() || !inst.param_is_output(pnum))
+				continue;
+
+			int const reg(param.ireg() - uml::REG_I0);
+			if ((inst.opcode() == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS) && inst.param(1).is_immediate())
+			{
+				value[reg] = inst.param(1).immediate();
+				known[reg] = inst.size();
+			}
+			else
+			{
+				known[reg] = 0;
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  forward_memory - reuse integer registers that
+//  are known to hold the same value as a memory
+//  location instead of reading it again
+//-------------------------------------------------
+
+void drcuml_block::forward_memory()
+{
+	struct alias
+	{
+		u8 const *  base;       // start of the memory
+		u8          size;       // bytes held in the register
+		int         reg;        // register holding the value
+	};
+	alias aliases[8];
+	int count(0);
+
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+
+		switch (inst.opcode())
+		{
+		// entry points, handlers and address space accesses can change anything
+		case uml::OP_HANDLE:
+		case uml::OP_HASH:
+		case uml::OP_LABEL:
+		case uml::OP_DEBUG:
+		case uml::OP_CALLH:
+		case uml::OP_CALLC:
+		case uml::OP_EXH:
+		case uml::OP_RECOVER:
+		case uml::OP_SAVE:
+		case uml::OP_RESTORE:
+		case uml::OP_STORE:
+		case uml::OP_READ:
+		case uml::OP_READM:
+		case uml::OP_WRITE:
+		case uml::OP_WRITEM:
+		case uml::OP_FSTORE:
+		case uml::OP_FREAD:
+		case uml::OP_FWRITE:
+			count = 0;
+			continue;
+
+		case uml::OP_COMMENT:
+		case uml::OP_MAPVAR:
+		case uml::OP_NOP:
+			continue;
+
+		default:
+			break;
+		}
+
+		// read from a register instead of memory where we can
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			uml::parameter const &param(inst.param(pnum));
+			if (!param.is_memory() || inst.param_is_output(pnum) || !inst.param_accepts(pnum, uml::parameter::PTYPE_INT_REGISTER))
+				continue;
+
+			u8 const *const base(reinterpret_cast<u8 const *>(param.memory()));
+			u8 const size(inst.param_size(pnum));
+			for (int index = 0; index < count; index++)
+			{
+				if ((aliases[index].base == base) && (aliases[index].size == size))
+				{
+					inst.set_param(pnum, uml::parameter::make_ireg(uml::REG_I0 + aliases[index].reg));
+					break;
+				}
+			}
+		}
+		inst.simplify();
+
+		// forget anything the instruction overwrites
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			uml::parameter const &param(inst.param(pnum));
+			if (!inst.param_is_output(pnum))
+				continue;
+
+			if (param.is_int_register())
+			{
+				int const reg(param.ireg() - uml::REG_I0);
+				count = std::remove_if(&aliases[0], &aliases[count], [reg] (alias const &a) { return a.reg == reg; }) - &aliases[0];
+			}
+			else if (param.is_memory())
+			{
+				u8 const *const base(reinterpret_cast<u8 const *>(param.memory()));
+				u8 const size(inst.param_size(pnum));
+				count = std::remove_if(&aliases[0], &aliases[count], [base, size] (alias const &a) { return (a.base < (base + size)) && (base < (a.base + a.size)); }) - &aliases[0];
+			}
+		}
+
+		// remember unconditional moves between registers and memory
+		if ((inst.opcode() == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS) && (count < std::size(aliases)))
+		{
+			uml::parameter const &dst(inst.param(0));
+			uml::parameter const &src(inst.param(1));
+			if (dst.is_memory() && src.is_int_register())
+				aliases[count++] = alias{ reinterpret_cast<u8 const *>(dst.memory()), inst.size(), src.ireg() - uml::REG_I0 };
+			else if (dst.is_int_register() && src.is_memory())
+				aliases[count++] = alias{ reinterpret_cast<u8 const *>(src.memory()), inst.size(), dst.ireg() - uml::REG_I0 };
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  remove_dead_code - drop unreachable code and
+//  register writes that are overwritten before
+//  they are read
+//-------------------------------------------------
+
+void drcuml_block::remove_dead_code()
+{
+	// code after an unconditional branch can only be reached via a label
+	bool reachable(true);
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+		switch (inst.opcode())
+		{
+		case uml::OP_HANDLE:
+		case uml::OP_HASH:
+		case uml::OP_LABEL:
+			reachable = true;
+			break;
+
+		// mapvars affect the recovery state of code that follows, so keep them
+		case uml::OP_COMMENT:
+		case uml::OP_MAPVAR:
+			break;
+
+		default:
+			if (!reachable)
+				inst.nop();
+			else if ((inst.condition() == uml::COND_ALWAYS) && ((inst.opcode() == uml::OP_JMP) || (inst.opcode() == uml::OP_EXIT) || (inst.opcode() == uml::OP_HASHJMP) || (inst.opcode() == uml::OP_RET)))
+				reachable = false;
+			break;
+		}
+	}
+
+	// side-effect free writes to a register are dead if it's written again before being read
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+		switch (inst.opcode())
+		{
+		case uml::OP_MOV:
+		case uml::OP_SET:
+		case uml::OP_SEXT:
+		case uml::OP_ROLAND:
+		case uml::OP_ADD:
+		case uml::OP_SUB:
+		case uml::OP_AND:
+		case uml::OP_OR:
+		case uml::OP_XOR:
+		case uml::OP_LZCNT:
+		case uml::OP_TZCNT:
+		case uml::OP_BSWAP:
+		case uml::OP_SHL:
+		case uml::OP_SHR:
+		case uml::OP_SAR:
+		case uml::OP_ROL:
+		case uml::OP_ROR:
+		case uml::OP_LOAD:
+		case uml::OP_LOADS:
+			break;
+
+		default:
+			continue;
+		}
+		if ((inst.condition() != uml::COND_ALWAYS) || (inst.flags() != 0) || !inst.param(0).is_int_register())
+			continue;
+
+		int const reg(inst.param(0).ireg());
+		u8 const size(inst.param_size(0));
+		bool dead(false);
+		for (int scannum = instnum + 1; scannum < m_nextinst; scannum++)
+		{
+			uml::instruction const &scan(m_inst[scannum]);
+			uml::opcode_t const op(scan.opcode());
+			if ((op == uml::OP_COMMENT) || (op == uml::OP_MAPVAR) || (op == uml::OP_NOP))
+				continue;
+
+			// anything that can transfer control might need the value
+			if ((op == uml::OP_HANDLE) || (op == uml::OP_HASH) || (op == uml::OP_LABEL) || (op == uml::OP_DEBUG) || (op == uml::OP_EXIT) || (op == uml::OP_HASHJMP) || (op == uml::OP_JMP) ||
+				(op == uml::OP_EXH) || (op == uml::OP_CALLH) || (op == uml::OP_RET) || (op == uml::OP_CALLC) || (op == uml::OP_RECOVER) || (op == uml::OP_SAVE) || (op == uml::OP_RESTORE))
+				break;
+
+			// a read keeps it alive
+			bool read(false), written(false);
+			for (int pnum = 0; pnum < scan.numparams(); pnum++)
+			{
+				if (!scan.param(pnum).is_int_register() || (scan.param(pnum).ireg() != reg))
+					continue;
+				if (scan.param_is_input(pnum))
+					read = true;
+				else if ((scan.condition() == uml::COND_ALWAYS) && (scan.param_size(pnum) >= size))
+					written = true;
+			}
+			if (read)
+				break;
+			if (written)
+			{
+				dead = true;
+				break;
+			}
+		}
+		if (dead)
+			inst.nop();
+	}
+}
+
+
+//-------------------------------------------------
+//  compact - squeeze out the NOPs left by the
+//  optimizer
+//-------------------------------------------------
+
+void drcuml_block::compact()
+{
+	auto const end(std::remove_if(m_inst.begin(), m_inst.begin() + m_nextinst, [] (uml::instruction const &inst) { return inst.opcode() == uml::OP_NOP; }));
+	m_nextinst = end - m_inst.begin();
 }
 
 
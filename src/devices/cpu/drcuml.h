@@ -18,6 +18,8 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -113,6 +115,10 @@ public:
 private:
 	// internal helpers
 	void optimize();
+	void propagate_constants();
+	void forward_memory();
+	void remove_dead_code();
+	void compact();
 	void disassemble();
 	char const *get_comment_text(uml::instruction const &inst, std::string &comment);
 
@@ -185,6 +191,16 @@ public:
 	void symbol_add(void *base, u32 length, char const *name);
 	char const *symbol_find(void *base, u32 *offset = nullptr);
 
+	// persistent translation cache
+	bool persist_enabled() const { return m_persist_enabled; }
+	void persist_memory(void const *base, size_t length, char const *name);
+	void persist_function(uml::c_function func, char const *name);
+	void persist_begin(u32 mode, offs_t pc);
+	void persist_add_code(offs_t pc, offs_t physpc, u32 length);
+	void persist_cancel() { m_persist_pending = false; }
+	void persist_capture(uml::instruction const *inst, u32 count);
+	bool persist_replay(u32 mode, offs_t pc);
+
 	// logging
 	bool logging() const { return bool(m_umllog); }
 	template <typename Format, typename... Params>
@@ -196,6 +212,12 @@ public:
 	void log_flush() { if (logging()) m_umllog->flush(); }
 	bool logging_native() const { return m_beintf->logging(); }
 
+	// statistics
+	void note_optimized(u32 before, u32 after) { m_optimize_before += before; m_optimize_after += after; }
+	void note_compiled() { m_blocks_compiled++; }
+	void note_aborted() { m_blocks_aborted++; }
+	void note_missing_code() { m_missing_code++; }
+
 private:
 	// symbol class
 	class symbol
@@ -220,6 +242,60 @@ private:
 		std::string m_name;     // name of the symbol
 	};
 
+	// a relocatable object referenced by a persisted block
+	struct persist_symbol
+	{
+		std::string             name;                   // name used to relocate it
+		u8 const *              memory = nullptr;       // base of memory, if any
+		size_t                  length = 0;             // length of memory
+		uml::c_function         func = nullptr;         // C function, if any
+		uml::code_handle *      handle = nullptr;       // code handle, if any
+	};
+
+	// a persisted UML parameter; memory, functions and handles refer to a symbol
+	struct persist_param
+	{
+		u8                      type;                   // uml::parameter::parameter_type
+		u16                     symbol;                 // symbol index for relocated types
+		u64                     value;                  // raw value, or offset from the symbol
+	};
+
+	// a persisted UML instruction
+	struct persist_inst
+	{
+		u8                      opcode;                 // uml::opcode_t
+		u8                      size;                   // operation size
+		u8                      condition;              // uml::condition_t
+		u8                      numparams;              // number of parameters
+		persist_param           param[uml::instruction::MAX_PARAMS];
+	};
+
+	// guest code a persisted block was translated from
+	struct persist_span
+	{
+		offs_t                  pc;                     // logical PC of the instruction
+		offs_t                  physpc;                 // physical PC it translated to
+		u32                     length;                 // length of the instruction
+		std::vector<u8>         bytes;                  // memory around the instruction, in whole 64-bit lanes
+	};
+
+	// a persisted block
+	struct persist_block
+	{
+		std::vector<persist_span>   spans;              // code the block depends on
+		std::vector<persist_inst>   insts;              // unoptimized UML
+	};
+
+	// persistence helpers
+	u16 persist_symbol_index(std::string const &name);
+	bool persist_read_code(offs_t physpc, u32 length, std::vector<u8> &bytes) const;
+	bool persist_encode(uml::parameter const &param, persist_param &result);
+	bool persist_decode(persist_param const &param, uml::parameter &result);
+	u32 persist_rom_checksum() const;
+	std::string persist_filename() const;
+	void persist_load();
+	void persist_save();
+
 	// internal state
 	device_t &                              m_device;           // CPU device we are associated with
 	drc_cache &                             m_cache;            // pointer to the codegen cache
@@ -228,6 +304,23 @@ private:
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
+	u64                                     m_optimize_before;  // instructions handed to the optimizer
+	u64                                     m_optimize_after;   // instructions left after optimizing
+	u32                                     m_blocks_compiled;  // blocks successfully generated
+	u32                                     m_blocks_aborted;   // blocks abandoned, usually for lack of cache space
+	u32                                     m_missing_code;     // dispatches that found no compiled code (cache misses)
+
+	// persistent translation cache state
+	bool                                    m_persist_enabled;  // persistent cache in use?
+	bool                                    m_persist_pending;  // capture the block being built?
+	u64                                     m_persist_key;      // mode and PC of the block being built
+	std::vector<persist_span>               m_persist_spans;    // code covered by the block being built
+	std::unordered_map<u64, persist_block>  m_persist_blocks;   // persisted blocks, keyed by mode and PC
+	std::vector<persist_symbol>             m_persist_symbols;  // symbols referenced by persisted blocks
+	std::unordered_map<std::string, u16>    m_persist_names;    // map from symbol name to index
+	u32                                     m_persist_romcrc;   // checksum of the ROM regions
+	u32                                     m_persist_loaded;   // number of blocks loaded
+	u32                                     m_persist_reused;   // number of blocks replayed
 };
 
 
@@ -168,6 +168,7 @@ void dspp_device::execute_run_drc()
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
+			drcuml->note_missing_code();
 			compile_block(m_core->m_pc);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
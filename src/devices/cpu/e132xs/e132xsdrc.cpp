@@ -30,6 +30,7 @@ void hyperstone_device::execute_run_drc()
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
+			m_drcuml->note_missing_code();
 			code_compile_block(m_core->global_regs[0]);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
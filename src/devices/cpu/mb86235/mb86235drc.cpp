@@ -231,6 +231,7 @@ void mb86235_device::run_drc()
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
+			drcuml->note_missing_code();
 			compile_block(m_core->pc);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
@@ -168,7 +168,7 @@ mips3_device::mips3_device(const machine_config &mconfig, device_type type, cons
 	, c_secondary_cache_line_size(0)
 	, m_fastram_select(0)
 	, m_debugger_temp(0)
-	, m_drc_cache(DRC_CACHE_SIZE + sizeof(internal_mips3_state) + 0x800000)
+	, m_drc_cache(drc_cache::configured_size(mconfig.options(), DRC_CACHE_SIZE) + sizeof(internal_mips3_state) + 0x800000)
 	, m_drcuml(nullptr)
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
@@ -481,6 +481,10 @@ void mips3_device::device_start()
 	m_drcuml->symbol_add(&m_core->numcycles, sizeof(m_core->numcycles), "numcycles");
 	m_drcuml->symbol_add(&m_fpmode, sizeof(m_fpmode), "fpmode");
 
+	/* let persisted translations find our state again */
+	if (m_drcuml->persist_enabled())
+		code_persist_register();
+
 	/* initialize the front-end helper */
 	m_drcfe = std::make_unique<mips3_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
 
@@ -5068,6 +5072,7 @@ void mips3_device::execute_run()
 			/* if we need to recompile, do it */
 			if (execute_result == EXECUTE_MISSING_CODE)
 			{
+				m_drcuml->note_missing_code();
 				code_compile_block(m_core->mode, m_core->pc);
 			}
 			else if (execute_result == EXECUTE_UNMAPPED_CODE)
@@ -595,6 +595,7 @@ private:
 	void save_fast_iregs(drcuml_block &block);
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
+	void code_persist_register();
 public:
 	void func_get_cycles();
 	void func_printf_exception();
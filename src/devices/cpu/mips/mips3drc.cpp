@@ -183,6 +183,8 @@ void mips3_device::add_fastram(offs_t start, offs_t end, uint8_t readonly, void
 		m_fastram[m_fastram_select].offset_base8 = (uint8_t*)base - start;
 		m_fastram[m_fastram_select].offset_base16 = (uint16_t*)((uint8_t*)base - start);
 		m_fastram[m_fastram_select].offset_base32 = (uint32_t*)((uint8_t*)base - start);
+		if (m_drcuml)
+			m_drcuml->persist_memory(base, end - start + 1, util::string_format("fastram%d", m_fastram_select).c_str());
 		m_fastram_select++;
 		// Set cache to dirty so that re-mapping occurs
 		m_drc_cache_dirty = true;
@@ -288,6 +290,23 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 
 	g_profiler.start(PROFILER_DRC_COMPILE);
 
+	/* reuse the translation from an earlier run if the code is unchanged */
+	if (m_drcuml->persist_enabled())
+	{
+		try
+		{
+			if (m_drcuml->persist_replay(mode, pc))
+			{
+				g_profiler.stop();
+				return;
+			}
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+
 	/* get a description of this sequence */
 	desclist = m_drcfe->describe_code(pc);
 	if (m_drcuml->logging() || m_drcuml->logging_native())
@@ -302,6 +321,25 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 			/* start the block */
 			drcuml_block &block(m_drcuml->begin_block(4096));
 
+			/* note the code it depends on in case it gets persisted */
+			if (m_drcuml->persist_enabled())
+			{
+				m_drcuml->persist_begin(mode, pc);
+				for (const opcode_desc *curdesc = desclist; curdesc != nullptr; curdesc = curdesc->next())
+				{
+					// TLB checks compare against the entry current at compile time, so they can't be replayed
+					m_drcuml->persist_add_code(curdesc->pc, curdesc->physpc, curdesc->length);
+					if (curdesc->flags & OPFLAG_VALIDATE_TLB)
+						m_drcuml->persist_cancel();
+					for (const opcode_desc *delay = curdesc->delay.first(); delay != nullptr; delay = delay->next())
+					{
+						m_drcuml->persist_add_code(delay->pc, delay->physpc, delay->length);
+						if (delay->flags & OPFLAG_VALIDATE_TLB)
+							m_drcuml->persist_cancel();
+					}
+				}
+			}
+
 			/* loop until we get through all instruction sequences */
 			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
 			{
@@ -561,6 +599,33 @@ static void cfunc_unimplemented(void *param)
 }
 
 
+/*-------------------------------------------------
+    code_persist_register - register the memory and
+    C functions translated blocks may reference,
+    so persisted blocks can be relocated
+-------------------------------------------------*/
+
+void mips3_device::code_persist_register()
+{
+	m_drcuml->persist_memory(m_core, sizeof(*m_core), "core");
+	m_drcuml->persist_memory(this, sizeof(*this), "device");
+	m_drcuml->persist_memory(vtlb_table(), vtlb_table_size() * sizeof(vtlb_entry), "vtlb");
+
+	m_drcuml->persist_function(cfunc_mips3com_update_cycle_counting, "update_cycle_counting");
+	m_drcuml->persist_function(cfunc_mips3com_asid_changed, "asid_changed");
+	m_drcuml->persist_function(cfunc_mips3com_tlbr, "tlbr");
+	m_drcuml->persist_function(cfunc_mips3com_tlbwi, "tlbwi");
+	m_drcuml->persist_function(cfunc_mips3com_tlbwr, "tlbwr");
+	m_drcuml->persist_function(cfunc_mips3com_tlbp, "tlbp");
+	m_drcuml->persist_function(cfunc_get_cycles, "get_cycles");
+	m_drcuml->persist_function(cfunc_printf_exception, "printf_exception");
+	m_drcuml->persist_function(cfunc_printf_debug, "printf_debug");
+	m_drcuml->persist_function(cfunc_printf_probe, "printf_probe");
+	m_drcuml->persist_function(cfunc_debug_break, "debug_break");
+	m_drcuml->persist_function(cfunc_unimplemented, "unimplemented");
+}
+
+
 /***************************************************************************
     STATIC CODEGEN
 ***************************************************************************/
@@ -648,6 +648,7 @@ protected:
 	uint32_t compute_spr(uint32_t spr);
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
+	void code_persist_register();
 	void static_generate_entry_point();
 	void static_generate_nocode_handler();
 	void static_generate_out_of_cycles();
@@ -241,7 +241,10 @@ void ppc_device::execute_run()
 
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
+		{
+			m_drcuml->note_missing_code();
 			code_compile_block(m_core->mode, m_core->pc);
+		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
 			fatalerror("Attempted to execute unmapped code at PC=%08X\n", m_core->pc);
 		else if (execute_result == EXECUTE_RESET_CACHE)
@@ -274,6 +277,8 @@ void ppc_device::ppcdrc_add_fastram(offs_t start, offs_t end, uint8_t readonly,
 		m_fastram[m_fastram_select].end = end;
 		m_fastram[m_fastram_select].readonly = readonly;
 		m_fastram[m_fastram_select].base = base;
+		if (m_drcuml)
+			m_drcuml->persist_memory(base, end - start + 1, util::string_format("fastram%d", m_fastram_select).c_str());
 		m_fastram_select++;
 	}
 }
@@ -385,6 +390,23 @@ void ppc_device::code_compile_block(uint8_t mode, offs_t pc)
 
 	g_profiler.start(PROFILER_DRC_COMPILE);
 
+	/* reuse the translation from an earlier run if the code is unchanged */
+	if (m_drcuml->persist_enabled())
+	{
+		try
+		{
+			if (m_drcuml->persist_replay(mode, pc))
+			{
+				g_profiler.stop();
+				return;
+			}
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+
 	/* get a description of this sequence */
 	desclist = m_drcfe->describe_code(pc);
 	if (m_drcuml->logging() || m_drcuml->logging_native())
@@ -398,6 +420,25 @@ void ppc_device::code_compile_block(uint8_t mode, offs_t pc)
 			/* start the block */
 			drcuml_block &block(m_drcuml->begin_block(4096));
 
+			/* note the code it depends on in case it gets persisted */
+			if (m_drcuml->persist_enabled())
+			{
+				m_drcuml->persist_begin(mode, pc);
+				for (const opcode_desc *curdesc = desclist; curdesc != nullptr; curdesc = curdesc->next())
+				{
+					// TLB checks compare against the entry current at compile time, so they can't be replayed
+					m_drcuml->persist_add_code(curdesc->pc, curdesc->physpc, curdesc->length);
+					if (curdesc->flags & OPFLAG_VALIDATE_TLB)
+						m_drcuml->persist_cancel();
+					for (const opcode_desc *delay = curdesc->delay.first(); delay != nullptr; delay = delay->next())
+					{
+						m_drcuml->persist_add_code(delay->pc, delay->physpc, delay->length);
+						if (delay->flags & OPFLAG_VALIDATE_TLB)
+							m_drcuml->persist_cancel();
+					}
+				}
+			}
+
 			/* loop until we get through all instruction sequences */
 			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
 			{
@@ -659,6 +700,39 @@ static void cfunc_ppccom_get_dsisr(void *param)
 	ppc->ppccom_get_dsisr();
 }
 
+
+/*-------------------------------------------------
+    code_persist_register - register the memory and
+    C functions translated blocks may reference,
+    so persisted blocks can be relocated
+-------------------------------------------------*/
+
+void ppc_device::code_persist_register()
+{
+	m_drcuml->persist_memory(m_core, sizeof(*m_core), "core");
+	m_drcuml->persist_memory(this, sizeof(*this), "device");
+	m_drcuml->persist_memory(vtlb_table(), vtlb_table_size() * sizeof(vtlb_entry), "vtlb");
+
+	m_drcuml->persist_function(cfunc_printf_exception, "printf_exception");
+	m_drcuml->persist_function(cfunc_printf_debug, "printf_debug");
+	m_drcuml->persist_function(cfunc_printf_probe, "printf_probe");
+	m_drcuml->persist_function(cfunc_unimplemented, "unimplemented");
+	m_drcuml->persist_function(cfunc_ppccom_mismatch, "mismatch");
+	m_drcuml->persist_function(cfunc_ppccom_tlb_fill, "tlb_fill");
+	m_drcuml->persist_function(cfunc_ppccom_update_fprf, "update_fprf");
+	m_drcuml->persist_function(cfunc_ppccom_dcstore_callback, "dcstore_callback");
+	m_drcuml->persist_function(cfunc_ppccom_execute_tlbie, "execute_tlbie");
+	m_drcuml->persist_function(cfunc_ppccom_execute_tlbia, "execute_tlbia");
+	m_drcuml->persist_function(cfunc_ppccom_execute_tlbl, "execute_tlbl");
+	m_drcuml->persist_function(cfunc_ppccom_execute_mfspr, "execute_mfspr");
+	m_drcuml->persist_function(cfunc_ppccom_execute_mftb, "execute_mftb");
+	m_drcuml->persist_function(cfunc_ppccom_execute_mtspr, "execute_mtspr");
+	m_drcuml->persist_function(cfunc_ppccom_tlb_flush, "tlb_flush");
+	m_drcuml->persist_function(cfunc_ppccom_execute_mfdcr, "execute_mfdcr");
+	m_drcuml->persist_function(cfunc_ppccom_execute_mtdcr, "execute_mtdcr");
+	m_drcuml->persist_function(cfunc_ppccom_get_dsisr, "get_dsisr");
+}
+
 /***************************************************************************
     STATIC CODEGEN
 ***************************************************************************/
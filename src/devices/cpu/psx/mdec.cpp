@@ -133,31 +133,32 @@ void psxmdec_device::mdec_cos_precalc()
 
 void psxmdec_device::mdec_idct( int32_t *p_n_src, int32_t *p_n_dst )
 {
+	// after run-length decoding only a handful of coefficients are set, so
+	// only those are multiplied in; the sums themselves are unchanged
+	uint8_t p_n_nonzero[ DCTSIZE2 ];
+	uint32_t n_nonzero = 0;
+
+	for( uint32_t n_vu = 0; n_vu < DCTSIZE2; n_vu++ )
+	{
+		if( p_n_src[ n_vu ] != 0 )
+		{
+			p_n_nonzero[ n_nonzero++ ] = n_vu;
+		}
+	}
+
 	int32_t *p_n_precalc = p_n_cos_precalc;
 
 	for( uint32_t n_yx = 0; n_yx < DCTSIZE2; n_yx++ )
 	{
-		int32_t p_n_z[ 8 ];
-		int32_t *p_n_data = p_n_src;
-
-		memset( p_n_z, 0, sizeof( p_n_z ) );
+		uint32_t n_z = 0;
 
-		for( uint32_t n_vu = 0; n_vu < DCTSIZE2 / 8; n_vu++ )
+		for( uint32_t n = 0; n < n_nonzero; n++ )
 		{
-			p_n_z[ 0 ] += p_n_data[ 0 ] * p_n_precalc[ 0 ];
-			p_n_z[ 1 ] += p_n_data[ 1 ] * p_n_precalc[ 1 ];
-			p_n_z[ 2 ] += p_n_data[ 2 ] * p_n_precalc[ 2 ];
-			p_n_z[ 3 ] += p_n_data[ 3 ] * p_n_precalc[ 3 ];
-			p_n_z[ 4 ] += p_n_data[ 4 ] * p_n_precalc[ 4 ];
-			p_n_z[ 5 ] += p_n_data[ 5 ] * p_n_precalc[ 5 ];
-			p_n_z[ 6 ] += p_n_data[ 6 ] * p_n_precalc[ 6 ];
-			p_n_z[ 7 ] += p_n_data[ 7 ] * p_n_precalc[ 7 ];
-			p_n_data += 8;
-			p_n_precalc += 8;
+			n_z += uint32_t( p_n_src[ p_n_nonzero[ n ] ] ) * uint32_t( p_n_precalc[ p_n_nonzero[ n ] ] );
 		}
 
-		*( p_n_dst++ ) = ( p_n_z[ 0 ] + p_n_z[ 1 ] + p_n_z[ 2 ] + p_n_z[ 3 ] +
-			p_n_z[ 4 ] + p_n_z[ 5 ] + p_n_z[ 6 ] + p_n_z[ 7 ] ) >> ( MDEC_COS_PRECALC_BITS + 2 );
+		*( p_n_dst++ ) = int32_t( n_z ) >> ( MDEC_COS_PRECALC_BITS + 2 );
+		p_n_precalc += DCTSIZE2;
 	}
 }
 
@@ -282,6 +282,7 @@ void rsp_device::execute_run_drc()
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
+			m_drcuml->note_missing_code();
 			code_compile_block(m_rsp_state->pc);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
@@ -2317,6 +2317,7 @@ void sh_common_execution::execute_run_drc()
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
+			m_drcuml->note_missing_code();
 			code_compile_block(0, m_sh2_state->pc);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
@@ -104,7 +104,7 @@ public:
 	sh_common_execution(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, endianness_t endianness, address_map_constructor internal)
 		: cpu_device(mconfig, type, tag, owner, clock)
 		, m_sh2_state(nullptr)
-		, m_cache(CACHE_SIZE + sizeof(internal_sh2_state))
+		, m_cache(drc_cache::configured_size(mconfig.options(), CACHE_SIZE) + sizeof(internal_sh2_state))
 		, m_drcuml(nullptr)
 		, m_drcoptions(0)
 		, m_entry(nullptr)
@@ -800,6 +800,7 @@ void adsp21062_device::execute_run_drc()
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
+			drcuml->note_missing_code();
 			compile_block(m_core->pc);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
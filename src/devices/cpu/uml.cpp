@@ -388,6 +388,92 @@ void uml::instruction::configure(opcode_t op, u8 size, parameter p0, parameter p
 }
 
 
+//-------------------------------------------------
+//  set_param - replace a parameter with another
+//  of a type the opcode accepts in that position
+//-------------------------------------------------
+
+void uml::instruction::set_param(int paramnum, parameter const &param)
+{
+	assert(paramnum < m_numparams);
+	assert(param_accepts(paramnum, param.type()));
+	m_param[paramnum] = param;
+}
+
+
+//-------------------------------------------------
+//  param_is_input - does the opcode read this
+//  parameter?
+//-------------------------------------------------
+
+bool uml::instruction::param_is_input(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return (s_opcode_info_table[m_opcode].param[paramnum].output & PIO_IN) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_is_output - does the opcode write this
+//  parameter?
+//-------------------------------------------------
+
+bool uml::instruction::param_is_output(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return (s_opcode_info_table[m_opcode].param[paramnum].output & PIO_OUT) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_accepts - can this parameter be of the
+//  given type?
+//-------------------------------------------------
+
+bool uml::instruction::param_accepts(int paramnum, parameter::parameter_type type) const
+{
+	assert(paramnum < m_numparams);
+	return ((s_opcode_info_table[m_opcode].param[paramnum].typemask >> type) & 1) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_size - return the number of bytes the
+//  opcode reads or writes through a parameter
+//-------------------------------------------------
+
+u8 uml::instruction::param_size(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	u8 const size = s_opcode_info_table[m_opcode].param[paramnum].size;
+	if (size == PSIZE_OP)
+		return m_size;
+	else if (size & 0x80)
+		return 1 << m_param[(size & 0x0f) - 1].size();
+	else
+		return 1 << size;
+}
+
+
+//-------------------------------------------------
+//  reconstruct - rebuild an instruction from a
+//  saved opcode, size, condition and parameters
+//-------------------------------------------------
+
+void uml::instruction::reconstruct(opcode_t op, u8 size, condition_t condition, u8 numparams, parameter const *params)
+{
+	assert(numparams <= MAX_PARAMS);
+	switch (numparams)
+	{
+		case 0: configure(op, size, condition); break;
+		case 1: configure(op, size, params[0], condition); break;
+		case 2: configure(op, size, params[0], params[1], condition); break;
+		case 3: configure(op, size, params[0], params[1], params[2], condition); break;
+		default: configure(op, size, params[0], params[1], params[2], params[3], condition); break;
+	}
+}
+
+
 //-------------------------------------------------
 //  simplify - simplify instructions that have
 //  immediate values we can evaluate at compile
@@ -405,6 +405,13 @@ namespace uml
 		// setters
 		void set_flags(u8 flags) { m_flags = flags; }
 		void set_mapvar(int paramnum, u32 value) { assert(paramnum < m_numparams); assert(m_param[paramnum].is_mapvar()); m_param[paramnum] = value; }
+		void set_param(int paramnum, parameter const &param);
+
+		// parameter information for the optimizer
+		bool param_is_input(int paramnum) const;
+		bool param_is_output(int paramnum) const;
+		bool param_accepts(int paramnum, parameter::parameter_type type) const;
+		u8 param_size(int paramnum) const;
 
 		// misc
 		std::string disasm(drcuml_state *drcuml = nullptr) const;
@@ -413,6 +420,9 @@ namespace uml
 		u8 modified_flags() const;
 		void simplify();
 
+		// rebuild from a saved opcode, size, condition and parameter list
+		void reconstruct(opcode_t op, u8 size, condition_t cond, u8 numparams, parameter const *params);
+
 		// compile-time opcodes
 		void handle(code_handle &hand) { configure(OP_HANDLE, 4, hand); }
 		void hash(u32 mode, u32 pc) { configure(OP_HASH, 4, mode, pc); }
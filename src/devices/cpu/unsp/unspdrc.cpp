@@ -33,6 +33,7 @@ void unsp_device::execute_run_drc()
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
+			m_drcuml->note_missing_code();
 			code_compile_block(UNSP_LPC);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
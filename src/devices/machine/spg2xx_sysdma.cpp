@@ -104,9 +104,22 @@ void spg2xx_sysdma_device::do_cpu_dma(uint32_t len)
 	uint32_t src = ((m_dma_regs[0x001] & 0x3f) << 16) | m_dma_regs[0x000];
 	uint32_t dst = m_dma_regs[0x003] & 0x3fff;
 
-	for (uint32_t j = 0; j < len; j++)
+	// a source that runs off the end of the space wraps back towards the destination
+	bool const src_linear = (u64(src) + len) <= (u64(mem.addrmask()) + 1);
+	if ((dst + len) <= 0x4000 && src_linear && (dst <= src || dst >= (src + len)) &&
+			mem.is_memory_block(read_or_write::READ, src, len) && mem.is_memory_block(read_or_write::WRITE, dst, len))
 	{
-		mem.write_word((dst + j) & 0x3fff, mem.read_word(src + j));
+		// memory to memory with no wrap or forward overlap, so copy in one go
+		m_dma_buffer.resize(len);
+		mem.read_block(src, m_dma_buffer.data(), len);
+		mem.write_block(dst, m_dma_buffer.data(), len);
+	}
+	else
+	{
+		for (uint32_t j = 0; j < len; j++)
+		{
+			mem.write_word((dst + j) & 0x3fff, mem.read_word(src + j));
+		}
 	}
 
 	src += len;
@@ -38,6 +38,7 @@ private:
 	void do_cpu_dma(uint32_t len);
 
 	uint16_t m_dma_regs[0x4];
+	std::vector<uint16_t> m_dma_buffer;
 
 	required_device<unsp_device> m_cpu;
 };
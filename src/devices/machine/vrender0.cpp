@@ -451,7 +451,23 @@ void vrender0soc_device::dmac_w(offs_t offset, uint32_t data, uint32_t mem_mask)
 		if ((CTR & 0xd4) != 0)
 			popmessage("DMA%d with unhandled mode %02x, contact MAMEdev",Which,CTR);
 
-		if (CTR & 0x2)  //32 bits
+		// work out the ranges in 64 bits so they can't wrap, and make sure neither
+		// runs off the end of the address space
+		u64 const space_end = u64(m_host_space->addrmask()) + 1;
+		u64 const src_end = u64(SRC) + (u64(CNT) * 4);
+		u64 const dst_end = u64(DST) + (u64(CNT) * 4);
+		bool const blockable = (src_end <= space_end) && (dst_end <= space_end) && ((DST <= SRC) || (DST >= src_end));
+
+		if ((CTR & 0x2) && src_inc == 4 && dst_inc == 4 && blockable &&
+				m_host_space->is_memory_block(read_or_write::READ, SRC, CNT) && m_host_space->is_memory_block(read_or_write::WRITE, DST, CNT))
+		{
+			// 32 bits, linear, memory to memory and not overlapping forwards, so
+			// the order of the individual accesses can't be observed
+			m_dma_buffer.resize(CNT);
+			m_host_space->read_block(SRC, m_dma_buffer.data(), CNT);
+			m_host_space->write_block(DST, m_dma_buffer.data(), CNT);
+		}
+		else if (CTR & 0x2)  //32 bits
 		{
 			for (int i = 0; i < CNT; ++i)
 			{
@@ -173,6 +173,7 @@ private:
 		uint32_t size = 0;
 		uint32_t ctrl = 0;
 	}m_dma[2];
+	std::vector<uint32_t> m_dma_buffer;
 
 	// CRTC
 	uint32_t crtc_r(offs_t offset);
@@ -1016,22 +1016,33 @@ void discrete_device::process(int samples)
 	if (samples == 0)
 		return;
 
-	/* Setup tasks */
-	for (const auto &task : task_list)
+	/* a single task has nothing to overlap with, so run it inline */
+	if (task_list.size() == 1)
 	{
-		/* unlock the thread */
-		task->unlock();
-
-		task->prepare_for_queue(samples);
+		discrete_task &task = *task_list.front();
+		task.prepare_for_queue(samples);
+		while (task.process())
+			;
 	}
-
-	for (const auto &task : task_list)
+	else
 	{
-		/* Fire a work item for each task */
-		(void)task;
-		osd_work_item_queue(m_queue, discrete_task::task_callback, (void *)&task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
+		/* Setup tasks */
+		for (const auto &task : task_list)
+		{
+			/* unlock the thread */
+			task->unlock();
+
+			task->prepare_for_queue(samples);
+		}
+
+		for (const auto &task : task_list)
+		{
+			/* Fire a work item for each task */
+			(void)task;
+			osd_work_item_queue(m_queue, discrete_task::task_callback, (void *)&task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
+		}
+		osd_work_queue_wait(m_queue, osd_ticks_per_second()*10);
 	}
-	osd_work_queue_wait(m_queue, osd_ticks_per_second()*10);
 
 	if (m_profiling)
 	{
@@ -343,11 +343,14 @@ void okim6295_device::okim_voice::generate_adpcm(device_rom_interface &rom, writ
 	if (!m_playing)
 		return;
 
+	// each byte holds two samples, so only go back to the ROM every other sample
+	u8 data = rom.read_byte(m_base_offset + m_sample / 2);
+
 	// loop while we still have samples to generate
 	for (int sampindex = 0; sampindex < buffer.samples(); sampindex++)
 	{
-		// fetch the next sample byte
-		int nibble = rom.read_byte(m_base_offset + m_sample / 2) >> (((m_sample & 1) << 2) ^ 4);
+		// extract the next nibble, high nibble first
+		int nibble = data >> (((m_sample & 1) << 2) ^ 4);
 
 		// output to the buffer, scaling by the volume
 		// signal in range -2048..2047
@@ -359,5 +362,9 @@ void okim6295_device::okim_voice::generate_adpcm(device_rom_interface &rom, writ
 			m_playing = false;
 			break;
 		}
+
+		// fetch the next sample byte once we've consumed both nibbles
+		if ((m_sample & 1) == 0)
+			data = rom.read_byte(m_base_offset + m_sample / 2);
 	}
 }
@@ -449,6 +449,9 @@ ymfm_operator<RegisterType>::ymfm_operator(RegisterType regs) :
 	m_key_state(0),
 	m_keyon(0),
 	m_csm_triggered(0),
+	m_cache_phase_step(0),
+	m_cache_block_freq(~0),
+	m_cache_keycode(0),
 	m_regs(regs)
 {
 }
@@ -491,6 +494,7 @@ void ymfm_operator<RegisterType>::reset()
 	m_key_state = 0;
 	m_keyon = 0;
 	m_csm_triggered = 0;
+	invalidate_cache();
 }
 
 
@@ -501,8 +505,17 @@ void ymfm_operator<RegisterType>::reset()
 template<class RegisterType>
 void ymfm_operator<RegisterType>::clock(u32 env_counter, s8 lfo_raw_pm, u16 block_freq)
 {
+	// the keycode and unmodulated phase step only depend on block_freq and
+	// the operator registers, so recompute them only when either changes
+	if (block_freq != m_cache_block_freq)
+	{
+		m_cache_block_freq = block_freq;
+		m_cache_keycode = block_freq_to_keycode(block_freq);
+		m_cache_phase_step = compute_phase_step(0, block_freq, m_cache_keycode);
+	}
+
 	// clock the key state
-	u8 keycode = block_freq_to_keycode(block_freq);
+	u8 keycode = m_cache_keycode;
 	clock_keystate(m_keyon | m_csm_triggered, keycode);
 	m_csm_triggered = 0;
 
@@ -849,14 +862,15 @@ void ymfm_operator<RegisterType>::clock_envelope(u16 env_counter, u8 keycode)
 
 
 //-------------------------------------------------
-//  clock_phase - clock the 10.10 phase value; the
-//  OPN version of the logic has been verified
+//  compute_phase_step - compute the 10.10 phase
+//  step for the current registers; the OPN
+//  version of the logic has been verified
 //  against the Nuked phase generator
 //-------------------------------------------------
 
 // OPM version
 template<>
-void ymfm_operator<ymopm_registers>::clock_phase(s8 lfo_raw_pm, u16 block_freq)
+u32 ymfm_operator<ymopm_registers>::compute_phase_step(s8 lfo_raw_pm, u16 block_freq, u8 keycode)
 {
 	// start with coarse detune delta; table uses cents value from
 	// manual, converted into 1/64ths
@@ -882,7 +896,7 @@ void ymfm_operator<ymopm_registers>::clock_phase(s8 lfo_raw_pm, u16 block_freq)
 	u32 phase_step = opm_keycode_to_phase_step(block_freq, delta);
 
 	// apply detune based on the keycode
-	phase_step += detune_adjustment(m_regs.detune(), block_freq_to_keycode(block_freq));
+	phase_step += detune_adjustment(m_regs.detune(), keycode);
 
 	// QUESTION: do we clamp to 17 bits like YM2612?
 
@@ -892,13 +906,11 @@ void ymfm_operator<ymopm_registers>::clock_phase(s8 lfo_raw_pm, u16 block_freq)
 		phase_step >>= 1;
 	else
 		phase_step *= multiple;
-
-	// finally apply the step to the current phase value
-	m_phase += phase_step;
+	return phase_step;
 }
 
 template<class RegisterType>
-void ymfm_operator<RegisterType>::clock_phase(s8 lfo_raw_pm, u16 block_freq)
+u32 ymfm_operator<RegisterType>::compute_phase_step(s8 lfo_raw_pm, u16 block_freq, u8 keycode)
 {
 	// extract frequency number (low 11 bits of block_freq)
 	u16 fnum = BIT(block_freq, 0, 11) << 1;
@@ -920,7 +932,7 @@ void ymfm_operator<RegisterType>::clock_phase(s8 lfo_raw_pm, u16 block_freq)
 	u32 phase_step = (fnum << block) >> 2;
 
 	// apply detune based on the keycode
-	phase_step += detune_adjustment(m_regs.detune(), block_freq_to_keycode(block_freq));
+	phase_step += detune_adjustment(m_regs.detune(), keycode);
 
 	// clamp to 17 bits in case detune overflows
 	// QUESTION: is this specific to the YM2612/3438?
@@ -932,9 +944,22 @@ void ymfm_operator<RegisterType>::clock_phase(s8 lfo_raw_pm, u16 block_freq)
 		phase_step >>= 1;
 	else
 		phase_step *= multiple;
+	return phase_step;
+}
 
-	// finally apply the step to the current phase value
-	m_phase += phase_step;
+
+//-------------------------------------------------
+//  clock_phase - advance the phase by the cached
+//  step, recomputing it only while PM is active
+//-------------------------------------------------
+
+template<class RegisterType>
+void ymfm_operator<RegisterType>::clock_phase(s8 lfo_raw_pm, u16 block_freq)
+{
+	if (m_regs.lfo_pm_sensitivity() != 0)
+		m_phase += compute_phase_step(lfo_raw_pm, block_freq, m_cache_keycode);
+	else
+		m_phase += m_cache_phase_step;
 }
 
 
@@ -1024,6 +1049,21 @@ void ymfm_channel<RegisterType>::reset()
 }
 
 
+//-------------------------------------------------
+//  invalidate_cache - discard cached per-operator
+//  values after a register change
+//-------------------------------------------------
+
+template<class RegisterType>
+void ymfm_channel<RegisterType>::invalidate_cache()
+{
+	m_op1.invalidate_cache();
+	m_op2.invalidate_cache();
+	m_op3.invalidate_cache();
+	m_op4.invalidate_cache();
+}
+
+
 //-------------------------------------------------
 //  keyonoff - signal key on/off to our operators
 //-------------------------------------------------
@@ -1316,6 +1356,9 @@ void ymfm_engine_base<RegisterType>::save(device_t &device)
 	// save channel data
 	for (int chnum = 0; chnum < RegisterType::CHANNELS; chnum++)
 		m_channel[chnum]->save(device, chnum);
+
+	// registers are restored behind our back, so treat everything as modified
+	device.machine().save().register_postload(save_prepost_delegate(FUNC(ymfm_engine_base<RegisterType>::postload), this));
 }
 
 
@@ -1357,6 +1400,11 @@ u32 ymfm_engine_base<RegisterType>::clock(u8 chanmask)
 	// also prepare every 4k samples to catch ending notes
 	if (m_modified_channels != 0 || m_prepare_count++ >= 4096)
 	{
+		// register writes can change cached phase steps
+		if (m_modified_channels != 0)
+			for (auto &chan : m_channel)
+				chan->invalidate_cache();
+
 		// call each channel to prepare
 		m_active_channels = 0;
 		for (int chnum = 0; chnum < RegisterType::CHANNELS; chnum++)
@@ -50,7 +50,7 @@
 //
 // Template specialization in functions that interpret the 'block_freq'
 // value is used to deconstruct it appropriately (specifically, see
-// clock_phase).
+// compute_phase_step).
 //
 //
 // LOW FREQUENCY OSCILLATOR (LFO)
@@ -626,6 +626,9 @@ public:
 	void keyonoff(u8 on) { m_keyon = on; }
 	void keyon_csm() { m_csm_triggered = 1; }
 
+	// discard cached values derived from the registers
+	void invalidate_cache() { m_cache_block_freq = ~0; }
+
 	// are we active?
 	bool active() const { return (m_env_state != ENV_RELEASE || m_env_attenuation < ENV_QUIET); }
 
@@ -648,6 +651,9 @@ private:
 	void clock_envelope(u16 env_counter, u8 keycode);
 	void clock_phase(s8 lfo_raw_pm, u16 block_freq);
 
+	// compute the phase step for the given frequency and PM value
+	u32 compute_phase_step(s8 lfo_raw_pm, u16 block_freq, u8 keycode);
+
 	// return effective attenuation of the envelope
 	u16 envelope_attenuation(u8 am_offset) const;
 
@@ -659,6 +665,9 @@ private:
 	u8 m_key_state;                  // current key state: on or off (bit 0)
 	u8 m_keyon;                      // live key on state (bit 0)
 	u8 m_csm_triggered;              // true if a CSM key on has been triggered (bit 0)
+	u32 m_cache_phase_step;          // cached phase step without PM
+	u32 m_cache_block_freq;          // block_freq the cache was computed for (~0 if invalid)
+	u8 m_cache_keycode;              // cached keycode for m_cache_block_freq
 	RegisterType m_regs;             // operator-specific registers
 };
 
@@ -666,7 +675,7 @@ template<>
 u8 ymfm_operator<ymopm_registers>::block_freq_to_keycode(u16 block_freq);
 
 template<>
-void ymfm_operator<ymopm_registers>::clock_phase(s8 lfo_raw_pm, u16 block_freq);
+u32 ymfm_operator<ymopm_registers>::compute_phase_step(s8 lfo_raw_pm, u16 block_freq, u8 keycode);
 
 
 // ======================> ymfm_channel
@@ -690,6 +699,9 @@ public:
 	// signal CSM key on to our operators
 	void keyon_csm();
 
+	// discard cached operator values after a register change
+	void invalidate_cache();
+
 	// master clocking function
 	void clock(u32 env_counter, s8 lfo_raw_pm, bool is_multi_freq);
 
@@ -800,6 +812,9 @@ private:
 	// handle a mode register write
 	TIMER_CALLBACK_MEMBER(synced_mode_w);
 
+	// invalidate cached state after loading
+	void postload() { m_modified_channels = 0xffffffff; }
+
 	// internal state
 	device_t &m_device;              // reference to the owning device
 	u32 m_env_counter;               // envelope counter; low 2 bits are sub-counter
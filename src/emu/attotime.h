@@ -341,7 +341,11 @@ inline constexpr attoseconds_t attotime::as_attoseconds() const noexcept
 /** as_ticks - convert to ticks at @p frequency */
 inline u64 attotime::as_ticks(u32 frequency) const
 {
-	u32 fracticks = (attotime(0, m_attoseconds) * frequency).m_seconds;
+	// same split as operator*=, but only the whole part is needed, and dividing by a
+	// compile-time constant lets the compiler avoid hardware divides altogether
+	u64 const attohi = u64(m_attoseconds) / ATTOSECONDS_PER_SECOND_SQRT;
+	u64 const attolo = u64(m_attoseconds) % ATTOSECONDS_PER_SECOND_SQRT;
+	u64 const fracticks = (attohi * frequency + attolo * frequency / ATTOSECONDS_PER_SECOND_SQRT) / ATTOSECONDS_PER_SECOND_SQRT;
 	return mulu_32x32(m_seconds, frequency) + fracticks;
 }
 
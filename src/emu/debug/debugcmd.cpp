@@ -296,6 +296,8 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 
 	m_console.register_command("history",   CMDFLAG_NONE, 0, 0, 2, std::bind(&debugger_commands::execute_history, this, _1, _2));
 	m_console.register_command("trackpc",   CMDFLAG_NONE, 0, 0, 3, std::bind(&debugger_commands::execute_trackpc, this, _1, _2));
+	m_console.register_command("coverage",  CMDFLAG_NONE, 0, 0, 3, std::bind(&debugger_commands::execute_coverage, this, _1, _2));
+	m_console.register_command("coveragesave", CMDFLAG_NONE, 0, 1, 2, std::bind(&debugger_commands::execute_coveragesave, this, _1, _2));
 
 	m_console.register_command("trackmem",  CMDFLAG_NONE, 0, 0, 3, std::bind(&debugger_commands::execute_trackmem, this, _1, _2));
 	m_console.register_command("pcatmemp",  CMDFLAG_NONE, AS_PROGRAM, 1, 2, std::bind(&debugger_commands::execute_pcatmem, this, _1, _2));
@@ -3555,6 +3557,80 @@ void debugger_commands::execute_trackpc(int ref, const std::vector<std::string>
 }
 
 
+/*-------------------------------------------------
+    execute_coverage - execute the coverage command
+-------------------------------------------------*/
+
+void debugger_commands::execute_coverage(int ref, const std::vector<std::string> &params)
+{
+	// Gather the on/off switch (if present)
+	bool turnOn = true;
+	if (params.size() > 0 && !validate_boolean_parameter(params[0], turnOn))
+		return;
+
+	// Gather the cpu id (if present)
+	device_t *cpu = nullptr;
+	if (!validate_cpu_parameter((params.size() > 1) ? params[1].c_str() : nullptr, cpu))
+		return;
+
+	// Should we clear the existing data?
+	bool clear = false;
+	if (params.size() > 2 && !validate_boolean_parameter(params[2], clear))
+		return;
+
+	if (clear)
+		cpu->debug()->coverage_clear();
+
+	cpu->debug()->set_coverage(turnOn);
+	m_console.printf("Coverage collection %s\n", turnOn ? "enabled" : "disabled");
+}
+
+
+/*-------------------------------------------------
+    execute_coveragesave - execute the
+    coveragesave command
+-------------------------------------------------*/
+
+void debugger_commands::execute_coveragesave(int ref, const std::vector<std::string> &params)
+{
+	// Gather the cpu id (if present)
+	device_t *cpu = nullptr;
+	if (!validate_cpu_parameter((params.size() > 1) ? params[1].c_str() : nullptr, cpu))
+		return;
+
+	int addrchars = 8;
+	device_memory_interface *memory;
+	if (cpu->interface(memory) && memory->has_space(AS_PROGRAM))
+		addrchars = memory->space(AS_PROGRAM).logaddrchars();
+
+	/* open the file */
+	FILE *f = fopen(params[0].c_str(), "w");
+	if (!f)
+	{
+		m_console.printf("Error opening file '%s'\n", params[0]);
+		return;
+	}
+
+	/* write one line per run of consecutive executed PCs */
+	std::vector<std::pair<offs_t, u8>> const coverage(cpu->debug()->coverage_snapshot());
+	fprintf(f, "# coverage for %s: start-end, PCs executed, lowest and highest count (saturating at 255)\n", cpu->tag());
+	for (auto run = coverage.begin(); run != coverage.end(); )
+	{
+		auto end = run;
+		u8 lowest = run->second, highest = run->second;
+		while ((++end != coverage.end()) && (end->first == (std::prev(end)->first + 1)))
+		{
+			lowest = std::min(lowest, end->second);
+			highest = std::max(highest, end->second);
+		}
+		fprintf(f, "%0*X-%0*X %u %u %u\n", addrchars, run->first, addrchars, std::prev(end)->first, unsigned(end - run), lowest, highest);
+		run = end;
+	}
+	fclose(f);
+	m_console.printf("Coverage of %u PCs saved to '%s'\n", unsigned(coverage.size()), params[0]);
+}
+
+
 /*-------------------------------------------------
     execute_trackmem - execute the trackmem command
 -------------------------------------------------*/
@@ -165,6 +165,8 @@ private:
 	void execute_traceflush(int ref, const std::vector<std::string> &params);
 	void execute_history(int ref, const std::vector<std::string> &params);
 	void execute_trackpc(int ref, const std::vector<std::string> &params);
+	void execute_coverage(int ref, const std::vector<std::string> &params);
+	void execute_coveragesave(int ref, const std::vector<std::string> &params);
 	void execute_trackmem(int ref, const std::vector<std::string> &params);
 	void execute_pcatmem(int ref, const std::vector<std::string> &params);
 	void execute_snap(int ref, const std::vector<std::string> &params);
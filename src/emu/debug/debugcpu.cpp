@@ -442,6 +442,10 @@ device_debug::device_debug(device_t &device)
 	, m_hotspot_threshhold(0)
 	, m_track_pc_set()
 	, m_track_pc(false)
+	, m_coverage()
+	, m_coverage_last(nullptr)
+	, m_coverage_last_page(0)
+	, m_coverage_enabled(false)
 	, m_comment_set()
 	, m_comment_change(0)
 	, m_track_mem_set()
@@ -525,7 +529,11 @@ device_debug::device_debug(device_t &device)
 	// set up execution-related stuff
 	if (m_exec != nullptr)
 	{
-		m_flags = DEBUG_FLAG_OBSERVING | DEBUG_FLAG_HISTORY;
+		m_flags = DEBUG_FLAG_OBSERVING;
+
+		// PC history requires the instruction hook on every instruction
+		if (device.machine().options().debug_history())
+			m_flags |= DEBUG_FLAG_HISTORY;
 
 		// if no curpc, add one
 		if (m_state && !m_symtable->find("curpc"))
@@ -735,6 +743,24 @@ void device_debug::instruction_hook(offs_t curpc)
 		m_track_pc_set.insert(dasm_pc_tag(curpc, crc));
 	}
 
+	// are we collecting coverage?
+	if (m_coverage_enabled)
+	{
+		// consecutive instructions usually share a page, so skip the lookup for those
+		offs_t const page = curpc >> COVERAGE_PAGE_BITS;
+		if (!m_coverage_last || (page != m_coverage_last_page))
+		{
+			std::unique_ptr<u8 []> &counters = m_coverage[page];
+			if (!counters)
+				counters = std::make_unique<u8 []>(COVERAGE_PAGE_SIZE);
+			m_coverage_last = counters.get();
+			m_coverage_last_page = page;
+		}
+		u8 &count = m_coverage_last[curpc & (COVERAGE_PAGE_SIZE - 1)];
+		if (count != 0xff)
+			count++;
+	}
+
 	// are we tracing?
 	if (m_trace != nullptr)
 		m_trace->update(curpc);
@@ -1414,6 +1440,43 @@ void device_debug::set_track_pc_visited(const offs_t& pc)
 }
 
 
+//-------------------------------------------------
+//  coverage_count - returns how many times the
+//  given pc has been executed, saturating at 255
+//-------------------------------------------------
+
+u8 device_debug::coverage_count(offs_t pc) const
+{
+	auto const page = m_coverage.find(pc >> COVERAGE_PAGE_BITS);
+	return (page != m_coverage.end()) ? page->second[pc & (COVERAGE_PAGE_SIZE - 1)] : 0;
+}
+
+
+//-------------------------------------------------
+//  coverage_snapshot - returns every executed pc
+//  with its count, in address order
+//-------------------------------------------------
+
+std::vector<std::pair<offs_t, u8>> device_debug::coverage_snapshot() const
+{
+	std::vector<offs_t> pages;
+	pages.reserve(m_coverage.size());
+	for (auto const &page : m_coverage)
+		pages.emplace_back(page.first);
+	std::sort(pages.begin(), pages.end());
+
+	std::vector<std::pair<offs_t, u8>> result;
+	for (offs_t page : pages)
+	{
+		u8 const *const counters = m_coverage.find(page)->second.get();
+		for (offs_t index = 0; index < COVERAGE_PAGE_SIZE; index++)
+			if (counters[index] != 0)
+				result.emplace_back((page << COVERAGE_PAGE_BITS) | index, counters[index]);
+	}
+	return result;
+}
+
+
 //-------------------------------------------------
 //  track_mem_pc_from_address_data - returns the pc that
 //  wrote the data to this address or (offs_t)(-1) for
@@ -1609,8 +1672,8 @@ void device_debug::compute_debug_flags()
 	if ((m_flags & (DEBUG_FLAG_HISTORY | DEBUG_FLAG_HOOKED | DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC | DEBUG_FLAG_LIVE_BP)) != 0)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
-	// also call if we are tracing
-	if (m_trace != nullptr)
+	// also call if we are tracing, tracking visited PCs or collecting coverage
+	if (m_trace != nullptr || m_track_pc || m_coverage_enabled)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
 	// if we are stopping at a particular time and that time is within the current timeslice, we need to be called
@@ -14,6 +14,8 @@
 #pragma once
 
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 
 //**************************************************************************
@@ -141,6 +143,13 @@ public:
 	void set_track_pc_visited(const offs_t& pc);
 	void track_pc_data_clear() { m_track_pc_set.clear(); }
 
+	// code coverage
+	void set_coverage(bool value) { m_coverage_enabled = value; }
+	bool coverage_enabled() const { return m_coverage_enabled; }
+	u8 coverage_count(offs_t pc) const;
+	std::vector<std::pair<offs_t, u8>> coverage_snapshot() const;
+	void coverage_clear() { m_coverage.clear(); m_coverage_last = nullptr; }
+
 	// memory tracking
 	void set_track_mem(bool value) { m_track_mem = value; }
 	offs_t track_mem_pc_from_space_address_data(const int& space,
@@ -273,12 +282,34 @@ private:
 			return (m_address < rhs.m_address);
 		}
 
+		// required to be included in an unordered set
+		bool operator == (const dasm_pc_tag& rhs) const
+		{
+			return (m_address == rhs.m_address) && (m_crc == rhs.m_crc);
+		}
+
+		struct hash
+		{
+			size_t operator () (const dasm_pc_tag& tag) const noexcept
+			{
+				return (size_t(tag.m_address) * 0x9e3779b1U) ^ size_t(tag.m_crc);
+			}
+		};
+
 		offs_t m_address;       // Stores [nothing] for a given address & crc32
 		u32    m_crc;
 	};
-	std::set<dasm_pc_tag> m_track_pc_set;
+	std::unordered_set<dasm_pc_tag, dasm_pc_tag::hash> m_track_pc_set;
 	bool m_track_pc;
 
+	// code coverage: one saturating execution counter per PC, allocated a page at a time
+	static constexpr unsigned COVERAGE_PAGE_BITS = 12;
+	static constexpr offs_t COVERAGE_PAGE_SIZE = offs_t(1) << COVERAGE_PAGE_BITS;
+	std::unordered_map<offs_t, std::unique_ptr<u8 []>> m_coverage; // counters, by page number
+	u8 *                    m_coverage_last;            // counters for the most recently hit page
+	offs_t                  m_coverage_last_page;       // page number of the most recently hit page
+	bool                    m_coverage_enabled;
+
 	// comments
 	class dasm_comment : public dasm_pc_tag
 	{
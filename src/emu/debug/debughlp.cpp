@@ -91,6 +91,8 @@ static const help_item static_help_list[] =
 		"  tracesym <item>[,...]] -- outputs one or more <item>s to the trace file\n"
 		"  history [<CPU>,<length>] -- outputs a brief history of visited opcodes\n"
 		"  trackpc [<bool>,<CPU>,<bool>] -- visually track visited opcodes [boolean to turn on and off, for the given CPU, clear]\n"
+		"  coverage [<bool>,<CPU>,<bool>] -- count executions of each PC [boolean to turn on and off, for the given CPU, clear]\n"
+		"  coveragesave <filename>[,<CPU>] -- save the executed PC ranges collected by coverage\n"
 		"  trackmem [<bool>,<bool>] -- record which PC writes to each memory address [boolean to turn on and off, clear]\n"
 		"  pcatmemp <address>[,<CPU>] -- query which PC wrote to a given program memory address for the current CPU\n"
 		"  pcatmemd <address>[,<CPU>] -- query which PC wrote to a given data memory address for the current CPU\n"
@@ -441,6 +443,40 @@ static const help_item static_help_list[] =
 		"trackpc 1, 0, 1\n"
 		"  Continue tracking pc on CPU 0, but clear existing track info.\n"
 	},
+	{
+		"coverage",
+		"\n"
+		"  coverage [<bool>,<CPU>,<bool>]\n"
+		"\n"
+		"The coverage command counts how many times each program counter is executed, saturating at "
+		"255.  The first boolean argument toggles the process on and off.  The second argument is a "
+		"CPU selector; if no CPU is specified, the current CPU is automatically selected.  The third "
+		"argument is a boolean denoting if the existing data should be cleared or not.  Use "
+		"coveragesave to write the collected data to a file.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"coverage 1\n"
+		"  Begin collecting coverage for the current CPU.\n"
+		"\n"
+		"coverage 1, 0, 1\n"
+		"  Continue collecting coverage on CPU 0, but clear the existing counts.\n"
+	},
+	{
+		"coveragesave",
+		"\n"
+		"  coveragesave <filename>[,<CPU>]\n"
+		"\n"
+		"The coveragesave command writes the coverage collected for a CPU to a text file.  Each line "
+		"covers one run of consecutive executed program counters and gives its start and end address, "
+		"the number of PCs in the run, and the lowest and highest execution count within it.  If no "
+		"CPU is specified, the current CPU is automatically selected.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"coveragesave maincpu.cov\n"
+		"  Save the coverage collected for the current CPU to maincpu.cov.\n"
+	},
 	{
 		"trackmem",
 		"\n"
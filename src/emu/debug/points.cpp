@@ -362,6 +362,9 @@ void debug_watchpoint::triggered(read_or_write type, offs_t address, u64 data, u
 	bool was_stopped = debug.cpu().is_stopped();
 	debug.cpu().set_execution_stopped();
 
+	// make sure the instruction hook runs next, even if PC history isn't keeping it on
+	machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
+
 	// evaluate the action
 	if (!m_action.empty())
 		debug.console().execute_command(m_action, false);
@@ -63,6 +63,10 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_nexteatcycles(0)
 	, m_trigger(0)
 	, m_inttrigger(0)
+	, m_stat_timeslices(0)
+	, m_stat_ticks(0)
+	, m_stat_aborts(0)
+	, m_stat_boosts(0)
 	, m_totalcycles(0)
 	, m_divisor(0)
 	, m_divshift(0)
@@ -98,6 +102,9 @@ void device_execute_interface::abort_timeslice() noexcept
 	if (!executing())
 		return;
 
+	if (UNEXPECTED(m_scheduler->m_profile_devices))
+		m_stat_aborts++;
+
 	// swallow the remaining cycles
 	if (m_icountptr != nullptr)
 	{
@@ -316,6 +316,12 @@ private:
 	s32                     m_trigger;                  // pending trigger to release a trigger suspension
 	s32                     m_inttrigger;               // interrupt trigger index
 
+	// execution statistics, only collected with -profile_devices
+	u64                     m_stat_timeslices;          // number of times the device was run
+	osd_ticks_t             m_stat_ticks;               // host time spent running the device
+	u64                     m_stat_aborts;              // number of aborted timeslices
+	u64                     m_stat_boosts;              // number of interleave boosts requested while running
+
 	// clock and timing information
 	u64                     m_totalcycles;              // total device cycles executed
 	attotime                m_localtime;                // local time, relative to the timer system's global time
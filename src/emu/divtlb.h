@@ -64,6 +64,7 @@ public:
 
 	// accessors
 	const vtlb_entry *vtlb_table() const;
+	size_t vtlb_table_size() const { return m_table.size(); }
 
 protected:
 	// interface-level overrides
@@ -72,6 +72,7 @@
 #include "disound.h"
 #include "divideo.h"
 #include "dinvram.h"
+#include "timerheap.h"
 #include "schedule.h"
 #include "dinetwork.h"
 
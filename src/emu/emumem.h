@@ -488,6 +488,7 @@ public:
 	static constexpr u32 F_UNITS       = 0x00000002; // handler that merges/splits an access among multiple handlers (unitmask support)
 	static constexpr u32 F_PASSTHROUGH = 0x00000004; // handler that passes through the request to another handler
 	static constexpr u32 F_VIEW        = 0x00000008; // handler for a view (kinda like dispatch except not entirely)
+	static constexpr u32 F_MEMORY      = 0x00000010; // handler for fixed (non-banked) memory, get_ptr stays valid until the map changes
 
 	// Start/end of range flags
 	static constexpr u8 START = 1;
@@ -518,6 +519,7 @@ public:
 	inline bool is_view() const { return m_flags & F_VIEW; }
 	inline bool is_units() const { return m_flags & F_UNITS; }
 	inline bool is_passthrough() const { return m_flags & F_PASSTHROUGH; }
+	inline bool is_memory() const { return m_flags & F_MEMORY; }
 
 	virtual void dump_map(std::vector<memory_entry> &map) const;
 
@@ -1062,6 +1064,11 @@ public:
 	void write_qword_unaligned(offs_t address, u64 data) { memory_write_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xffffffffffffffffU); }
 	void write_qword_unaligned(offs_t address, u64 data, u64 mask) { memory_write_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
 
+	inline void read_block(offs_t address, NativeType *data, u32 count);
+	inline void write_block(offs_t address, const NativeType *data, u32 count);
+	inline void fill_block(offs_t address, NativeType data, u32 count);
+	inline bool is_memory_block(read_or_write readorwrite, offs_t address, u32 count) const;
+
 private:
 	address_space *             m_space;
 
@@ -1105,6 +1112,7 @@ public:
 		  m_addrend_w(0),
 		  m_cache_r(nullptr),
 		  m_cache_w(nullptr),
+		  m_direct_r(nullptr),
 		  m_root_read(nullptr),
 		  m_root_write(nullptr)
 	{
@@ -1117,6 +1125,7 @@ public:
 		if(address >= m_addrstart_r && address <= m_addrend_r)
 			return;
 		m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+		update_direct_r();
 	}
 
 	void check_address_w(offs_t address) {
@@ -1175,12 +1184,14 @@ private:
 	offs_t                      m_addrend_w;               // maximum valid address for writing
 	handler_entry_read <Width, AddrShift, Endian> *m_cache_r;  // read cache
 	handler_entry_write<Width, AddrShift, Endian> *m_cache_w;  // write cache
+	const NativeType *          m_direct_r;                // direct pointer to m_addrstart_r when the read cache is plain memory
 
 	handler_entry_read <Width, AddrShift, Endian> *m_root_read;  // decode tree roots
 	handler_entry_write<Width, AddrShift, Endian> *m_root_write;
 
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0));
 	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0));
+	void update_direct_r();
 
 	void set(address_space *space, std::pair<void *, void *> rw);
 };
@@ -1546,6 +1557,11 @@ class address_space : public address_space_installer
 		int m_id;
 	};
 
+	struct range_notifier_t {
+		std::function<void (read_or_write, offs_t, offs_t)> m_notifier;
+		int m_id;
+	};
+
 protected:
 	// construction/destruction
 	address_space(memory_manager &manager, device_memory_interface &memory, int spacenum);
@@ -1586,14 +1602,30 @@ public:
 	}
 
 	int add_change_notifier(std::function<void (read_or_write)> n);
+	int add_range_change_notifier(std::function<void (read_or_write, offs_t, offs_t)> n);
 	void remove_change_notifier(int id);
 
 	void invalidate_caches(read_or_write mode) {
+		invalidate_hot_paths(mode);
 		if(u32(mode) & ~m_in_notification) {
 			u32 old = m_in_notification;
 			m_in_notification |= u32(mode);
 			for(const auto &n : m_notifiers)
 				n.m_notifier(mode);
+			for(const auto &n : m_range_notifiers)
+				n.m_notifier(mode, 0, addrmask());
+			m_in_notification = old;
+		}
+	}
+
+	// only notify the range notifiers whose cached range overlaps start-end, as when a view switches
+	void invalidate_caches(read_or_write mode, offs_t start, offs_t end) {
+		invalidate_hot_paths(mode);
+		if(u32(mode) & ~m_in_notification) {
+			u32 old = m_in_notification;
+			m_in_notification |= u32(mode);
+			for(const auto &n : m_range_notifiers)
+				n.m_notifier(mode, start, end);
 			m_in_notification = old;
 		}
 	}
@@ -1602,6 +1634,9 @@ public:
 
 	virtual void remove_passthrough(std::unordered_set<handler_entry *> &handlers) = 0;
 
+	// drop any RAM/ROM fast path ranges and profile again
+	virtual void invalidate_hot_paths(read_or_write mode) = 0;
+
 	u64 unmap() const { return m_unmap; }
 
 	memory_passthrough_handler *make_mph();
@@ -1647,6 +1682,16 @@ public:
 	virtual void write_qword_unaligned(offs_t address, u64 data) = 0;
 	virtual void write_qword_unaligned(offs_t address, u64 data, u64 mask) = 0;
 
+	// block accessors, in units of the native data width; data is an
+	// array of u8/u16/u32/u64 matching data_width(), in host order
+	virtual void read_block(offs_t address, void *data, u32 count) = 0;
+	virtual void write_block(offs_t address, const void *data, u32 count) = 0;
+	virtual void fill_block(offs_t address, u64 data, u32 count) = 0;
+
+	// whether a block is entirely plain memory (RAM, ROM or banks) with no
+	// handlers or taps, so it can be copied instead of accessed in order
+	virtual bool is_memory_block(read_or_write readorwrite, offs_t address, u32 count) = 0;
+
 	// setup
 	void prepare_map();
 	void prepare_device_map(address_map &map);
@@ -1684,6 +1729,7 @@ protected:
 	std::vector<std::unique_ptr<memory_passthrough_handler>> m_mphs;
 
 	std::vector<notifier_t> m_notifiers;        // notifier list for address map change
+	std::vector<range_notifier_t> m_range_notifiers; // notifier list for changes limited to a range
 	int                     m_notifier_id;      // next notifier id
 	u32                     m_in_notification;  // notification(s) currently being done
 };
@@ -2003,9 +2049,27 @@ read_native(offs_t address, typename emu::detail::handler_entry_size<Width>::uX
 {
 	address &= m_addrmask;
 	check_address_r(address);
+	if(m_direct_r)
+		return m_direct_r[(address - m_addrstart_r) >> (Width + AddrShift)];
 	return m_cache_r->read(address, mask);
 }
 
+template<int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_cache<Width, AddrShift, Endian>::
+update_direct_r()
+{
+	// plain memory can be read straight through a pointer as long as the
+	// cached range maps linearly onto it, i.e. the handler's address mask
+	// doesn't wrap inside the range
+	m_direct_r = nullptr;
+	if(m_cache_r->is_memory() && !(m_addrstart_r & NATIVE_MASK)) {
+		auto const start = reinterpret_cast<const NativeType *>(m_cache_r->get_ptr(m_addrstart_r));
+		auto const end = reinterpret_cast<const NativeType *>(m_cache_r->get_ptr(m_addrend_r & ~NATIVE_MASK));
+		if(end - start == ((m_addrend_r - m_addrstart_r) >> (Width + AddrShift)))
+			m_direct_r = start;
+	}
+}
+
 template<int Width, int AddrShift, endianness_t Endian>
 void emu::detail::memory_access_cache<Width, AddrShift, Endian>::
 write_native(offs_t address, typename emu::detail::handler_entry_size<Width>::uX data, typename emu::detail::handler_entry_size<Width>::uX mask)
@@ -2032,6 +2096,35 @@ set(address_space *space, std::pair<const void *, const void *> rw)
 }
 
 
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+read_block(offs_t address, NativeType *data, u32 count)
+{
+	m_space->read_block(address, data, count);
+}
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+write_block(offs_t address, const NativeType *data, u32 count)
+{
+	m_space->write_block(address, data, count);
+}
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+fill_block(offs_t address, NativeType data, u32 count)
+{
+	m_space->fill_block(address, data, count);
+}
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+bool emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+is_memory_block(read_or_write readorwrite, offs_t address, u32 count) const
+{
+	return m_space->is_memory_block(readorwrite, address, count);
+}
+
+
 template<int Width, int AddrShift, endianness_t Endian>
 void emu::detail::memory_access_cache<Width, AddrShift, Endian>::
 set(address_space *space, std::pair<void *, void *> rw)
@@ -2039,13 +2132,14 @@ set(address_space *space, std::pair<void *, void *> rw)
 	m_space = space;
 	m_addrmask = space->addrmask();
 
-	space->add_change_notifier([this](read_or_write mode) {
-								   if(u32(mode) & u32(read_or_write::READ)) {
+	space->add_range_change_notifier([this](read_or_write mode, offs_t start, offs_t end) {
+								   if((u32(mode) & u32(read_or_write::READ)) && m_addrstart_r <= end && m_addrend_r >= start) {
 									   m_addrend_r = 0;
 									   m_addrstart_r = 1;
 									   m_cache_r = nullptr;
+									   m_direct_r = nullptr;
 								   }
-								   if(u32(mode) & u32(read_or_write::WRITE)) {
+								   if((u32(mode) & u32(read_or_write::WRITE)) && m_addrstart_w <= end && m_addrend_w >= start) {
 									   m_addrend_w = 0;
 									   m_addrstart_w = 1;
 									   m_cache_w = nullptr;
@@ -2058,6 +2152,7 @@ set(address_space *space, std::pair<void *, void *> rw)
 	m_addrstart_r = 1;
 	m_addrend_r = 0;
 	m_cache_r = nullptr;
+	m_direct_r = nullptr;
 	m_addrstart_w = 1;
 	m_addrend_w = 0;
 	m_cache_w = nullptr;
@@ -10,6 +10,8 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include <algorithm>
+#include <array>
 #include <list>
 #include <map>
 #include "emuopts.h"
@@ -299,6 +301,7 @@ public:
 	// construction/destruction
 	address_space_specific(memory_manager &manager, device_memory_interface &memory, int spacenum, int address_width)
 		: address_space(manager, memory, spacenum)
+		, m_hot_enabled(manager.machine().options().memory_hotpath())
 	{
 		m_unmap_r = new handler_entry_read_unmapped <Width, AddrShift, Endian>(this);
 		m_unmap_w = new handler_entry_write_unmapped<Width, AddrShift, Endian>(this);
@@ -345,6 +348,8 @@ public:
 
 		m_dispatch_read  = m_root_read ->get_dispatch();
 		m_dispatch_write = m_root_write->get_dispatch();
+
+		invalidate_hot_paths(read_or_write::READWRITE);
 	}
 
 	std::pair<void *, void *> get_cache_info() override {
@@ -391,6 +396,15 @@ public:
 		m_root_write->detach(handlers);
 	}
 
+	virtual void invalidate_hot_paths(read_or_write mode) override {
+		if(!m_hot_enabled)
+			return;
+		if(u32(mode) & u32(read_or_write::READ))
+			m_hot_read.reset();
+		if(u32(mode) & u32(read_or_write::WRITE))
+			m_hot_write.reset();
+	}
+
 	// generate accessor table
 	virtual void accessors(data_accessors &accessors) const override
 	{
@@ -425,25 +439,40 @@ public:
 	// native read
 	NativeType read_native(offs_t offset, NativeType mask)
 	{
-		return dispatch_read<Level, Width, AddrShift, Endian>(offs_t(-1), offset & m_addrmask, mask, m_dispatch_read);
+		offset &= m_addrmask;
+		if(m_hot_read.active()) {
+			const hot_range *range = hot_read_lookup(offset);
+			if(range)
+				return range->memory[((offset - range->base) & range->mask) >> (Width + AddrShift)];
+		}
+		return dispatch_read<Level, Width, AddrShift, Endian>(offs_t(-1), offset, mask, m_dispatch_read);
 	}
 
 	// mask-less native read
 	NativeType read_native(offs_t offset)
 	{
-		return dispatch_read<Level, Width, AddrShift, Endian>(offs_t(-1), offset & m_addrmask, uX(0xffffffffffffffffU), m_dispatch_read);
+		return read_native(offset, uX(0xffffffffffffffffU));
 	}
 
 	// native write
 	void write_native(offs_t offset, NativeType data, NativeType mask)
 	{
-		dispatch_write<Level, Width, AddrShift, Endian>(offs_t(-1), offset & m_addrmask, data, mask, m_dispatch_write);
+		offset &= m_addrmask;
+		if(m_hot_write.active()) {
+			const hot_range *range = hot_write_lookup(offset);
+			if(range) {
+				uX &target = range->memory[((offset - range->base) & range->mask) >> (Width + AddrShift)];
+				target = (target & ~mask) | (data & mask);
+				return;
+			}
+		}
+		dispatch_write<Level, Width, AddrShift, Endian>(offs_t(-1), offset, data, mask, m_dispatch_write);
 	}
 
 	// mask-less native write
 	void write_native(offs_t offset, NativeType data)
 	{
-		dispatch_write<Level, Width, AddrShift, Endian>(offs_t(-1), offset & m_addrmask, data, uX(0xffffffffffffffffU), m_dispatch_write);
+		write_native(offset, data, uX(0xffffffffffffffffU));
 	}
 
 	// virtual access to these functions
@@ -475,6 +504,115 @@ public:
 	void write_qword_unaligned(offs_t address, u64 data) override { memory_write_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, 0xffffffffffffffffU); }
 	void write_qword_unaligned(offs_t address, u64 data, u64 mask) override { memory_write_generic<Width, AddrShift, Endian, 3, false>([this](offs_t offset, NativeType data, NativeType mask) { write_native(offset, data, mask); }, address, data, mask); }
 
+	// block accesses, resolved once per run of addresses served by the same
+	// handler and copied directly when that handler is backed by memory
+	void read_block(offs_t address, void *data, u32 count) override
+	{
+		check_block_address("read_block", address);
+		uX *dest = static_cast<uX *>(data);
+		while(count) {
+			address &= m_addrmask & ~NATIVE_MASK;
+			offs_t start, end;
+			handler_entry_read<Width, AddrShift, Endian> *handler;
+			m_root_read->lookup(address, start, end, handler);
+			const u32 run = block_run(address, end, count);
+			const uX *src = static_cast<const uX *>(handler->get_ptr(address));
+			if(src && handler->get_ptr(address + (run - 1) * NATIVE_STEP) == src + run - 1)
+				std::copy_n(src, run, dest);
+			else
+				for(u32 i = 0; i != run; i++)
+					dest[i] = read_native(address + i * NATIVE_STEP);
+			address += run * NATIVE_STEP;
+			dest += run;
+			count -= run;
+		}
+	}
+
+	void write_block(offs_t address, const void *data, u32 count) override
+	{
+		check_block_address("write_block", address);
+		const uX *src = static_cast<const uX *>(data);
+		while(count) {
+			address &= m_addrmask & ~NATIVE_MASK;
+			offs_t start, end;
+			handler_entry_write<Width, AddrShift, Endian> *handler;
+			m_root_write->lookup(address, start, end, handler);
+			const u32 run = block_run(address, end, count);
+			uX *dest = static_cast<uX *>(handler->get_ptr(address));
+			if(dest && handler->get_ptr(address + (run - 1) * NATIVE_STEP) == dest + run - 1)
+				std::copy_n(src, run, dest);
+			else
+				for(u32 i = 0; i != run; i++)
+					write_native(address + i * NATIVE_STEP, src[i]);
+			address += run * NATIVE_STEP;
+			src += run;
+			count -= run;
+		}
+	}
+
+	void fill_block(offs_t address, u64 data, u32 count) override
+	{
+		check_block_address("fill_block", address);
+		while(count) {
+			address &= m_addrmask & ~NATIVE_MASK;
+			offs_t start, end;
+			handler_entry_write<Width, AddrShift, Endian> *handler;
+			m_root_write->lookup(address, start, end, handler);
+			const u32 run = block_run(address, end, count);
+			uX *dest = static_cast<uX *>(handler->get_ptr(address));
+			if(dest && handler->get_ptr(address + (run - 1) * NATIVE_STEP) == dest + run - 1)
+				std::fill_n(dest, run, uX(data));
+			else
+				for(u32 i = 0; i != run; i++)
+					write_native(address + i * NATIVE_STEP, uX(data));
+			address += run * NATIVE_STEP;
+			count -= run;
+		}
+	}
+
+	bool is_memory_block(read_or_write readorwrite, offs_t address, u32 count) override
+	{
+		if(address & NATIVE_MASK)
+			return false;
+		while(count) {
+			address &= m_addrmask;
+			offs_t start, end;
+			const void *base, *last;
+			u32 run;
+			if(readorwrite == read_or_write::READ) {
+				handler_entry_read<Width, AddrShift, Endian> *handler;
+				m_root_read->lookup(address, start, end, handler);
+				run = block_run(address, end, count);
+				base = handler->get_ptr(address);
+				last = handler->get_ptr(address + (run - 1) * NATIVE_STEP);
+			} else {
+				handler_entry_write<Width, AddrShift, Endian> *handler;
+				m_root_write->lookup(address, start, end, handler);
+				run = block_run(address, end, count);
+				base = handler->get_ptr(address);
+				last = handler->get_ptr(address + (run - 1) * NATIVE_STEP);
+			}
+			if(!base || last != static_cast<const uX *>(base) + run - 1)
+				return false;
+			address += run * NATIVE_STEP;
+			count -= run;
+		}
+		return true;
+	}
+
+	// number of native units from address up to the end of a handler range
+	static u32 block_run(offs_t address, offs_t end, u32 count)
+	{
+		return u32(std::min<u64>(count, (u64(end) - address) / NATIVE_STEP + 1));
+	}
+
+	// block accesses work in whole native units only
+	void check_block_address(const char *function, offs_t address) const
+	{
+		if(address & NATIVE_MASK)
+			fatalerror("%s of unaligned address %x in space %s of device '%s'\n", function, address, m_name, m_device.tag());
+	}
+
 	// static access to these functions
 	static u8 read_byte_static(this_type &space, offs_t address) { return Width == 0 ? space.read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 0, true>([&space](offs_t offset, NativeType mask) -> NativeType { return space.read_native(offset, mask); }, address, 0xff); }
 	static u16 read_word_static(this_type &space, offs_t address) { return Width == 1 ? space.read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 1, true>([&space](offs_t offset, NativeType mask) -> NativeType { return space.read_native(offset, mask); }, address, 0xffff); }
@@ -497,6 +635,94 @@ public:
 	std::unordered_set<handler_entry *> m_delayed_unrefs;
 
 private:
+	// RAM/ROM fast path: accesses are counted per handler range for a
+	// while, then the hottest plain memory ranges are served directly
+	// ahead of the dispatch until the map, a tap or a view changes
+	static constexpr u32 HOT_RANGES = 4;            // ranges served ahead of the dispatch
+	static constexpr u32 HOT_CANDIDATES = 16;       // ranges counted while profiling
+	static constexpr u32 HOT_PROFILE = 0x10000;     // accesses profiled before choosing
+
+	struct hot_range
+	{
+		offs_t start, end;                          // range served by the handler
+		offs_t base, mask;                          // handler address base and mask
+		uX *memory;                                 // backing memory
+	};
+
+	struct hot_candidate
+	{
+		offs_t start, end;                          // range served by the handler
+		u32 count;                                  // accesses seen
+	};
+
+	struct hot_path
+	{
+		std::array<hot_range, HOT_RANGES> ranges;
+		std::array<hot_candidate, HOT_CANDIDATES> candidates;
+		u32 range_count = 0;                        // ranges currently served
+		u32 candidate_count = 0;                    // ranges counted so far
+		u32 profile_left = 0;                       // accesses still to profile
+
+		bool active() const { return range_count | profile_left; }
+		void reset() { range_count = 0; candidate_count = 0; profile_left = HOT_PROFILE; }
+
+		const hot_range *find(offs_t offset) const {
+			for(u32 i = 0; i != range_count; i++)
+				if(offset >= ranges[i].start && offset <= ranges[i].end)
+					return &ranges[i];
+			return nullptr;
+		}
+
+		// count an access, returns true once enough accesses have been seen
+		template<typename Handler> bool count(offs_t offset, const Handler *root) {
+			u32 i;
+			for(i = 0; i != candidate_count; i++)
+				if(offset >= candidates[i].start && offset <= candidates[i].end)
+					break;
+			if(i != candidate_count)
+				candidates[i].count++;
+			else if(candidate_count != HOT_CANDIDATES) {
+				Handler *handler;
+				hot_candidate &candidate = candidates[candidate_count++];
+				root->lookup(offset, candidate.start, candidate.end, handler);
+				candidate.count = 1;
+			}
+			return !--profile_left;
+		}
+
+		// keep the busiest candidates that are served by plain memory
+		template<typename Memory, typename Handler> void choose(const Handler *root) {
+			std::sort(candidates.begin(), candidates.begin() + candidate_count, [](const hot_candidate &a, const hot_candidate &b) { return a.count > b.count; });
+			range_count = 0;
+			for(u32 i = 0; i != candidate_count && range_count != HOT_RANGES; i++) {
+				offs_t start, end;
+				Handler *handler;
+				root->lookup(candidates[i].start, start, end, handler);
+				const Memory *memory = dynamic_cast<const Memory *>(handler);
+				if(memory)
+					ranges[range_count++] = hot_range{ start, end, memory->address_base(), memory->address_mask(), memory->base() };
+			}
+		}
+	};
+
+	const hot_range *hot_read_lookup(offs_t offset) {
+		const hot_range *range = m_hot_read.find(offset);
+		if(!range && m_hot_read.profile_left && m_hot_read.count(offset, m_root_read))
+			m_hot_read.template choose<handler_entry_read_memory<Width, AddrShift, Endian>>(m_root_read);
+		return range;
+	}
+
+	const hot_range *hot_write_lookup(offs_t offset) {
+		const hot_range *range = m_hot_write.find(offset);
+		if(!range && m_hot_write.profile_left && m_hot_write.count(offset, m_root_write))
+			m_hot_write.template choose<handler_entry_write_memory<Width, AddrShift, Endian>>(m_root_write);
+		return range;
+	}
+
+	bool     m_hot_enabled;                         // fast path mode requested
+	hot_path m_hot_read;                            // fast path for reads
+	hot_path m_hot_write;                           // fast path for writes
+
 	template<typename READ>
 	void install_read_handler_impl(offs_t addrstart, offs_t addrend, offs_t addrmask, offs_t addrmirror, offs_t addrselect, u64 unitmask, int cswidth, READ &handler_r)
 	{
@@ -1231,6 +1457,13 @@ int address_space::add_change_notifier(std::function<void (read_or_write)> n)
 	return id;
 }
 
+int address_space::add_range_change_notifier(std::function<void (read_or_write, offs_t, offs_t)> n)
+{
+	int id = m_notifier_id++;
+	m_range_notifiers.emplace_back(range_notifier_t{ std::move(n), id });
+	return id;
+}
+
 void address_space::remove_change_notifier(int id)
 {
 	for(auto i = m_notifiers.begin(); i != m_notifiers.end(); i++)
@@ -1238,5 +1471,10 @@ void address_space::remove_change_notifier(int id)
 			m_notifiers.erase(i);
 			return;
 		}
+	for(auto i = m_range_notifiers.begin(); i != m_range_notifiers.end(); i++)
+		if (i->m_id == id) {
+			m_range_notifiers.erase(i);
+			return;
+		}
 	fatalerror("Unknown notifier id %d, double remove?\n", id);
 }
@@ -18,6 +18,9 @@ public:
 		m_address_mask = mask;
 	}
 
+	inline offs_t address_base() const { return m_address_base; }
+	inline offs_t address_mask() const { return m_address_mask; }
+
 protected:
 	offs_t m_address_base, m_address_mask;
 };
@@ -37,6 +40,9 @@ public:
 		m_address_mask = mask;
 	}
 
+	inline offs_t address_base() const { return m_address_base; }
+	inline offs_t address_mask() const { return m_address_mask; }
+
 protected:
 	offs_t m_address_base, m_address_mask;
 };
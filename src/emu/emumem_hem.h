@@ -14,11 +14,12 @@ template<int Width, int AddrShift, endianness_t Endian> class handler_entry_read
 public:
 	using uX = typename emu::detail::handler_entry_size<Width>::uX;
 
-	handler_entry_read_memory(address_space *space, void *base) : handler_entry_read_address<Width, AddrShift, Endian>(space, 0), m_base(reinterpret_cast<uX *>(base)) {}
+	handler_entry_read_memory(address_space *space, void *base) : handler_entry_read_address<Width, AddrShift, Endian>(space, handler_entry::F_MEMORY), m_base(reinterpret_cast<uX *>(base)) {}
 	~handler_entry_read_memory() = default;
 
 	uX read(offs_t offset, uX mem_mask) const override;
 	void *get_ptr(offs_t offset) const override;
+	uX *base() const { return m_base; }
 
 	std::string name() const override;
 
@@ -35,6 +36,7 @@ public:
 	~handler_entry_write_memory() = default;
 
 	void write(offs_t offset, uX data, uX mem_mask) const override;
+	uX *base() const { return m_base; }
 	void *get_ptr(offs_t offset) const override;
 
 	std::string name() const override;
@@ -653,7 +653,7 @@ void memory_view::register_state()
 {
 	m_device.machine().save().save_item(&m_device, "view", m_name.c_str(), 0, NAME(m_cur_slot));
 	m_device.machine().save().save_item(&m_device, "view", m_name.c_str(), 0, NAME(m_cur_id));
-	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() { m_handler_read->select_a(m_cur_id); m_handler_write->select_a(m_cur_id); })));
+	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() { m_handler_read->select_a(m_cur_id); m_handler_write->select_a(m_cur_id); m_space->invalidate_caches(read_or_write::READWRITE); })));
 }
 
 void memory_view::disable()
@@ -662,6 +662,7 @@ void memory_view::disable()
 	m_cur_id = -1;
 	m_handler_read->select_a(-1);
 	m_handler_write->select_a(-1);
+	m_space->invalidate_caches(read_or_write::READWRITE, m_addrstart, m_addrend);
 }
 
 void memory_view::select(int slot)
@@ -671,9 +672,15 @@ void memory_view::select(int slot)
 		fatalerror("memory_view %s: select of unknown slot %d", m_name, slot);
 
 	m_cur_slot = slot;
+
+	// reselecting the active variant changes nothing, so leave the hot paths alone
+	if (i->second == m_cur_id)
+		return;
+
 	m_cur_id = i->second;
 	m_handler_read->select_a(m_cur_id);
 	m_handler_write->select_a(m_cur_id);
+	m_space->invalidate_caches(read_or_write::READWRITE, m_addrstart, m_addrend);
 }
 
 int memory_view::id_to_slot(int id) const
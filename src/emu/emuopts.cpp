@@ -59,11 +59,13 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SNAPSHOT_DIRECTORY,                         "snap",      OPTION_STRING,     "directory to save/load screenshots" },
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      OPTION_STRING,     "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  OPTION_STRING,     "directory to save debugger comments" },
+	{ OPTION_DRC_CACHE_DIRECTORY,                        "drc",       OPTION_STRING,     "directory to save persistent DRC translations" },
 
 	// state/playback options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
 	{ OPTION_STATE,                                      nullptr,     OPTION_STRING,     "saved state to load" },
 	{ OPTION_AUTOSAVE,                                   "0",         OPTION_BOOLEAN,    "automatically restore state on start and save on exit for supported systems" },
+	{ OPTION_ASYNC_SAVE,                                 "0",         OPTION_BOOLEAN,    "compress and write save states in the background" },
 	{ OPTION_REWIND,                                     "0",         OPTION_BOOLEAN,    "enable rewind savestates" },
 	{ OPTION_REWIND_CAPACITY "(1-2048)",                 "100",       OPTION_INTEGER,    "rewind buffer size in megabytes" },
 	{ OPTION_PLAYBACK ";pb",                             nullptr,     OPTION_STRING,     "playback an input file" },
@@ -86,11 +88,17 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_AUTOFRAMESKIP ";afs",                       "0",         OPTION_BOOLEAN,    "enable automatic frameskip adjustment to maintain emulation speed" },
 	{ OPTION_FRAMESKIP ";fs(0-10)",                      "0",         OPTION_INTEGER,    "set frameskip to fixed value, 0-10 (upper limit with autoframeskip)" },
 	{ OPTION_SECONDS_TO_RUN ";str",                      "0",         OPTION_INTEGER,    "number of emulated seconds to run before automatically exiting" },
+	{ OPTION_BENCH_REPORT,                               nullptr,     OPTION_STRING,     "optional filename to write a JSON report of per-frame timing on exit" },
+	{ OPTION_FORK_SERVER,                                nullptr,     OPTION_STRING,     "local socket path to serve forked copies of the machine after reset; requires -video none -sound none; jobs do not save NVRAM or configuration (POSIX only)" },
 	{ OPTION_THROTTLE,                                   "1",         OPTION_BOOLEAN,    "throttle emulation to keep system running in sync with real time" },
 	{ OPTION_SLEEP,                                      "1",         OPTION_BOOLEAN,    "enable sleeping, which gives time back to other applications when idle" },
+	{ OPTION_SLEEP_JITTER "(0-10000)",                   "0",         OPTION_INTEGER,    "microseconds a throttled frame may finish early instead of spin-waiting; 0 spins for exact timing" },
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         OPTION_BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_MEMORY_HOTPATH,                             "0",         OPTION_BOOLEAN,    "profile address space accesses and serve the hottest RAM/ROM ranges ahead of the handler dispatch" },
+	{ OPTION_PARALLEL_TILEMAPS,                          "0",         OPTION_BOOLEAN,    "split tilemap drawing into horizontal bands rendered on separate threads" },
+	{ OPTION_PARALLEL_RENDER,                            "0",         OPTION_BOOLEAN,    "split software rendering and snapshots into horizontal bands rendered on separate threads" },
 
 	// render options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE RENDER OPTIONS" },
@@ -141,6 +149,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SAMPLES,                                    "1",         OPTION_BOOLEAN,    "enable the use of external samples if available" },
 	{ OPTION_VOLUME ";vol",                              "0",         OPTION_INTEGER,    "sound volume in decibels (-32 min, 0 max)" },
 	{ OPTION_SPEAKER_REPORT,                             "0",         OPTION_INTEGER,    "print report of speaker ouput maxima (0=none, or 1-4 for more detail)" },
+	{ OPTION_SOUND_UPDATE_RATE "(50-1000)",              "50",        OPTION_INTEGER,    "number of times per emulated second the final mix is sent to the OSD; higher values deliver sound in smaller, lower-latency chunks" },
 
 	// input options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE INPUT OPTIONS" },
@@ -181,6 +190,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UPDATEINPAUSE,                              "0",         OPTION_BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,     OPTION_STRING,     "script for debugger" },
 	{ OPTION_DEBUGLOG,                                   "0",         OPTION_BOOLEAN,    "write debug console output to debug.log" },
+	{ OPTION_DEBUG_HISTORY,                              "1",         OPTION_BOOLEAN,    "record PC history for every CPU; when disabled, only CPUs with breakpoints, traces or stepping are hooked on every instruction, and a watchpoint hit turns the hook on" },
+	{ OPTION_PROFILE_DEVICES,                            "0",         OPTION_BOOLEAN,    "collect per-device execution statistics and report them on exit" },
 
 	// comm options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE COMM OPTIONS" },
@@ -196,6 +207,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DRC_USE_C,                                  "0",         OPTION_BOOLEAN,    "force DRC to use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         OPTION_BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         OPTION_BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_PERSIST,                                "0",         OPTION_BOOLEAN,    "reuse DRC translations saved by previous runs" },
+	{ OPTION_DRC_CACHE_SIZE "(0-1024)",                  "0",         OPTION_INTEGER,    "DRC code cache size in megabytes (0 = CPU default)" },
 	{ OPTION_BIOS,                                       nullptr,     OPTION_STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         OPTION_BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         OPTION_BOOLEAN,    "skip displaying the system information screen at startup" },
@@ -47,10 +47,12 @@
 #define OPTION_SNAPSHOT_DIRECTORY   "snapshot_directory"
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
+#define OPTION_DRC_CACHE_DIRECTORY  "drc_cache_directory"
 
 // core state/playback options
 #define OPTION_STATE                "state"
 #define OPTION_AUTOSAVE             "autosave"
+#define OPTION_ASYNC_SAVE           "async_save"
 #define OPTION_REWIND               "rewind"
 #define OPTION_REWIND_CAPACITY      "rewind_capacity"
 #define OPTION_PLAYBACK             "playback"
@@ -71,11 +73,17 @@
 #define OPTION_AUTOFRAMESKIP        "autoframeskip"
 #define OPTION_FRAMESKIP            "frameskip"
 #define OPTION_SECONDS_TO_RUN       "seconds_to_run"
+#define OPTION_BENCH_REPORT         "bench_report"
+#define OPTION_FORK_SERVER          "fork_server"
 #define OPTION_THROTTLE             "throttle"
 #define OPTION_SLEEP                "sleep"
+#define OPTION_SLEEP_JITTER         "sleep_jitter"
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_MEMORY_HOTPATH       "memory_hotpath"
+#define OPTION_PARALLEL_TILEMAPS    "parallel_tilemaps"
+#define OPTION_PARALLEL_RENDER      "parallel_render"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -120,6 +128,7 @@
 #define OPTION_SAMPLES              "samples"
 #define OPTION_VOLUME               "volume"
 #define OPTION_SPEAKER_REPORT       "speaker_report"
+#define OPTION_SOUND_UPDATE_RATE    "sound_update_rate"
 
 // core input options
 #define OPTION_COIN_LOCKOUT         "coin_lockout"
@@ -157,12 +166,16 @@
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
 #define OPTION_DEBUGLOG             "debuglog"
+#define OPTION_DEBUG_HISTORY        "debug_history"
+#define OPTION_PROFILE_DEVICES      "profile_devices"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_PERSIST          "drc_persist"
+#define OPTION_DRC_CACHE_SIZE       "drc_cache_size"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -331,10 +344,12 @@ public:
 	const char *snapshot_directory() const { return value(OPTION_SNAPSHOT_DIRECTORY); }
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
+	const char *drc_cache_directory() const { return value(OPTION_DRC_CACHE_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
+	bool async_save() const { return bool_value(OPTION_ASYNC_SAVE); }
 	int rewind() const { return bool_value(OPTION_REWIND); }
 	int rewind_capacity() const { return int_value(OPTION_REWIND_CAPACITY); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
@@ -355,11 +370,17 @@ public:
 	bool auto_frameskip() const { return bool_value(OPTION_AUTOFRAMESKIP); }
 	int frameskip() const { return int_value(OPTION_FRAMESKIP); }
 	int seconds_to_run() const { return int_value(OPTION_SECONDS_TO_RUN); }
+	const char *bench_report() const { return value(OPTION_BENCH_REPORT); }
+	const char *fork_server() const { return value(OPTION_FORK_SERVER); }
 	bool throttle() const { return bool_value(OPTION_THROTTLE); }
 	bool sleep() const { return m_sleep; }
+	int sleep_jitter() const { return int_value(OPTION_SLEEP_JITTER); }
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	bool memory_hotpath() const { return bool_value(OPTION_MEMORY_HOTPATH); }
+	bool parallel_tilemaps() const { return bool_value(OPTION_PARALLEL_TILEMAPS); }
+	bool parallel_render() const { return bool_value(OPTION_PARALLEL_RENDER); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -404,6 +425,7 @@ public:
 	bool samples() const { return bool_value(OPTION_SAMPLES); }
 	int volume() const { return int_value(OPTION_VOLUME); }
 	int speaker_report() const { return int_value(OPTION_SPEAKER_REPORT); }
+	int sound_update_rate() const { return int_value(OPTION_SOUND_UPDATE_RATE); }
 
 	// core input options
 	bool coin_lockout() const { return bool_value(OPTION_COIN_LOCKOUT); }
@@ -439,12 +461,16 @@ public:
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
 	bool debuglog() const { return bool_value(OPTION_DEBUGLOG); }
+	bool debug_history() const { return bool_value(OPTION_DEBUG_HISTORY); }
+	bool profile_devices() const { return bool_value(OPTION_PROFILE_DEVICES); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_persist() const { return bool_value(OPTION_DRC_PERSIST); }
+	int drc_cache_size() const { return int_value(OPTION_DRC_CACHE_SIZE); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
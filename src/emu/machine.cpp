@@ -95,6 +95,13 @@
 #include <emscripten.h>
 #endif
 
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
 
 
 //**************************************************************************
@@ -120,6 +127,7 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 		m_paused(false),
 		m_hard_reset_pending(false),
 		m_exit_pending(false),
+		m_fork_child(false),
 		m_soft_reset_timer(nullptr),
 		m_rand_seed(0x9d14abd7),
 		m_ui_active(_config.options().ui_active()),
@@ -128,6 +136,9 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 		m_saveload_schedule(saveload_schedule::NONE),
 		m_saveload_schedule_time(attotime::zero),
 		m_saveload_searchpath(nullptr),
+		m_save_queue(nullptr),
+		m_http_metrics_ticks(0),
+		m_http_metrics_frames(0),
 
 		m_save(*this),
 		m_memory(*this),
@@ -200,6 +211,14 @@ void running_machine::start()
 	// allocate a soft_reset timer
 	m_soft_reset_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::soft_reset), this));
 
+	// set up background saves if requested
+	if (options().async_save())
+	{
+		m_save_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+		add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&running_machine::poll_async_saves, this));
+		add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::finish_async_saves, this));
+	}
+
 	// initialize UI input
 	m_ui_input = std::make_unique<ui_input_manager>(*this);
 
@@ -263,6 +282,8 @@ void running_machine::start()
 	// register callbacks for the devices, then start them
 	add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&running_machine::reset_all_devices, this));
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
+	if (m_scheduler.profiling_devices())
+		add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::dump_stats, &m_scheduler));
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
 	start_all_devices();
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
@@ -368,6 +389,10 @@ int running_machine::run(bool quiet)
 
 		export_http_api();
 
+		// hand out copies of the reset machine if requested
+		if (*options().fork_server())
+			serve_forks();
+
 		m_hard_reset_pending = false;
 
 #if defined(__EMSCRIPTEN__)
@@ -398,11 +423,15 @@ int running_machine::run(bool quiet)
 		// and out via the exit phase
 		m_current_phase = machine_phase::EXIT;
 
-		// save the NVRAM and configuration
+		// save the NVRAM and configuration; forked jobs share the server's
+		// files and run concurrently, so they leave them alone
 		sound().ui_mute(true);
-		if (options().nvram_save())
-			nvram_save();
-		m_configuration->save_settings();
+		if (!m_fork_child)
+		{
+			if (options().nvram_save())
+				nvram_save();
+			m_configuration->save_settings();
+		}
 	}
 	catch (emu_fatalerror &fatal)
 	{
@@ -447,6 +476,17 @@ int running_machine::run(bool quiet)
 
 	// close the logfile
 	m_logfile.reset();
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+	// a forked job inherited thread objects (HTTP server, work queues as
+	// they were in the server) that can't be joined here, so leave without
+	// running the normal teardown
+	if (m_fork_child)
+	{
+		fflush(nullptr);
+		::_exit(error);
+	}
+#endif
 	return error;
 }
 
@@ -929,6 +969,9 @@ void running_machine::handle_saveload()
 	{
 		const char *const opname = (m_saveload_schedule == saveload_schedule::LOAD) ? "load" : "save";
 
+		// earlier background saves must be on disk before the file is read or reopened
+		wait_async_saves();
+
 		// if there are anonymous timers, we can't save just yet, and we can't load yet either
 		// because the timers might overwrite data we have loaded
 		if (!m_scheduler.can_save())
@@ -939,6 +982,15 @@ void running_machine::handle_saveload()
 			else
 				return; // return without cancelling the operation
 		}
+		else if (m_save_queue && m_saveload_schedule == saveload_schedule::SAVE)
+		{
+			// background save: open the file here, then capture and hand it off
+			auto file = std::make_unique<emu_file>(m_saveload_searchpath ? m_saveload_searchpath : "", OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+			if (file->open(m_saveload_pending_file) == osd_file::error::NONE)
+				start_async_save(std::move(file));
+			else
+				popmessage("Error: Failed to open file for %s operation.", opname);
+		}
 		else
 		{
 			u32 const openflags = (m_saveload_schedule == saveload_schedule::LOAD) ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
@@ -954,39 +1006,17 @@ void running_machine::handle_saveload()
 				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(file) : m_save.write_file(file);
 
 				// handle the result
-				switch (saverr)
-				{
-				case STATERR_ILLEGAL_REGISTRATIONS:
-					popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
-					break;
-
-				case STATERR_INVALID_HEADER:
-					popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
-					break;
-
-				case STATERR_READ_ERROR:
-					popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
-					break;
-
-				case STATERR_WRITE_ERROR:
-					popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
-					break;
-
-				case STATERR_NONE:
-					if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
-						popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
-					else
-						popmessage("State successfully %s.", opnamed);
-					break;
-
-				default:
-					popmessage("Error: Unknown error during state %s.", opnamed);
-					break;
-				}
+				report_saveload(saverr, opname, opnamed);
 
 				// close and perhaps delete the file
 				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
 					file.remove_on_close();
+				if (m_saveload_schedule == saveload_schedule::SAVE)
+				{
+					std::string const filename = file.filename();
+					file.close();
+					emulator_info::state_saved_hook(filename.c_str(), saverr == STATERR_NONE);
+				}
 			}
 			else if (openflags == OPEN_FLAG_READ && filerr == osd_file::error::NOT_FOUND)
 			{
@@ -1007,6 +1037,148 @@ void running_machine::handle_saveload()
 }
 
 
+//-------------------------------------------------
+//  report_saveload - tell the user how a save or
+//  load went
+//-------------------------------------------------
+
+void running_machine::report_saveload(save_error saverr, const char *opname, const char *opnamed)
+{
+	switch (saverr)
+	{
+	case STATERR_ILLEGAL_REGISTRATIONS:
+		popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
+		break;
+
+	case STATERR_INVALID_HEADER:
+		popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
+		break;
+
+	case STATERR_READ_ERROR:
+		popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
+		break;
+
+	case STATERR_WRITE_ERROR:
+		popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
+		break;
+
+	case STATERR_NONE:
+		if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
+			popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
+		else
+			popmessage("State successfully %s.", opnamed);
+		break;
+
+	default:
+		popmessage("Error: Unknown error during state %s.", opnamed);
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  start_async_save - capture the state into a
+//  buffer and queue compressing and writing it
+//-------------------------------------------------
+
+void running_machine::start_async_save(std::unique_ptr<emu_file> &&file)
+{
+	auto save = std::make_unique<async_save>();
+	save->m_filename = file->filename();
+	save->m_data.resize(ram_state::get_size(m_save));
+
+	// only the capture happens on the emulation thread
+	save_error const saverr = m_save.write_buffer(&save->m_data[0], save->m_data.size());
+	if (saverr != STATERR_NONE)
+	{
+		file->remove_on_close();
+		report_saveload(saverr, "save", "saved");
+		emulator_info::state_saved_hook(save->m_filename.c_str(), false);
+		return;
+	}
+
+	save->m_file = std::move(file);
+	save->m_error = STATERR_NONE;
+	save->m_item = osd_work_item_queue(m_save_queue, write_async_save, save.get(), 0);
+	if (!save->m_item)
+	{
+		// no worker available, write it here instead
+		write_async_save(save.get(), 0);
+		save->m_item = nullptr;
+	}
+	m_async_saves.emplace_back(std::move(save));
+	poll_async_saves();
+}
+
+
+//-------------------------------------------------
+//  write_async_save - work queue callback that
+//  compresses and writes a captured state
+//-------------------------------------------------
+
+void *running_machine::write_async_save(void *param, int threadid)
+{
+	async_save &save = *reinterpret_cast<async_save *>(param);
+	save.m_error = save_manager::write_buffer_to_file(*save.m_file, &save.m_data[0], save.m_data.size());
+	if (save.m_error != STATERR_NONE)
+		save.m_file->remove_on_close();
+	save.m_file.reset();
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  poll_async_saves - report background saves
+//  that have been written and closed
+//-------------------------------------------------
+
+void running_machine::poll_async_saves()
+{
+	for (auto it = m_async_saves.begin(); it != m_async_saves.end(); )
+	{
+		async_save &save = **it;
+		if (save.m_item && !osd_work_item_wait(save.m_item, 0))
+		{
+			++it;
+			continue;
+		}
+		if (save.m_item)
+			osd_work_item_release(save.m_item);
+
+		report_saveload(save.m_error, "save", "saved");
+		emulator_info::state_saved_hook(save.m_filename.c_str(), save.m_error == STATERR_NONE);
+		it = m_async_saves.erase(it);
+	}
+}
+
+
+//-------------------------------------------------
+//  wait_async_saves - block until all background
+//  saves have been written and reported
+//-------------------------------------------------
+
+void running_machine::wait_async_saves()
+{
+	for (auto const &save : m_async_saves)
+		if (save->m_item)
+			while (!osd_work_item_wait(save->m_item, osd_ticks_per_second() * 10)) { }
+	poll_async_saves();
+}
+
+
+//-------------------------------------------------
+//  finish_async_saves - wait for background saves
+//  before the machine goes away
+//-------------------------------------------------
+
+void running_machine::finish_async_saves()
+{
+	wait_async_saves();
+	osd_work_queue_free(m_save_queue);
+	m_save_queue = nullptr;
+}
+
+
 //-------------------------------------------------
 //  soft_reset - actually perform a soft-reset
 //  of the system
@@ -1289,9 +1461,207 @@ void running_machine::export_http_api()
 			response->set_content_type("application/json");
 			response->set_body(s.GetString());
 		});
+
+		// the server thread only ever sees a complete snapshot built by the emulation thread
+		publish_http_metrics();
+		add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&running_machine::publish_http_metrics, this));
+		m_manager.http()->add_http_handler("/api/metrics", [this](http_manager::http_request_ptr request, http_manager::http_response_ptr response)
+		{
+			std::shared_ptr<std::string const> const metrics(std::atomic_load(&m_http_metrics));
+			response->set_status(200);
+			response->set_content_type("application/json");
+			response->set_body(*metrics);
+		});
 	}
 }
 
+
+//-------------------------------------------------
+//  publish_http_metrics - rebuild the metrics
+//  served over HTTP, at most four times a second
+//-------------------------------------------------
+
+void running_machine::publish_http_metrics()
+{
+	osd_ticks_t const now = osd_ticks();
+	osd_ticks_t const elapsed = now - m_http_metrics_ticks;
+	if (m_http_metrics && (elapsed < (osd_ticks_per_second() / 4)))
+		return;
+
+	u64 const frames = m_video->frame_count();
+	u64 const newframes = frames - m_http_metrics_frames;
+
+	rapidjson::StringBuffer s;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+	writer.Key("name");
+	writer.String(m_basename.c_str());
+	writer.Key("frames");
+	writer.Uint64(frames);
+	writer.Key("speed_percent");
+	writer.Double(100.0 * m_video->speed_percent());
+	writer.Key("emulated_seconds");
+	writer.Double(time().as_double());
+
+	// average host time per frame since the previous snapshot
+	writer.Key("frame_ms");
+	writer.Double((m_http_metrics && newframes) ? (1000.0 * double(elapsed) / double(osd_ticks_per_second()) / double(newframes)) : 0.0);
+
+	// per-device execution; timing and slice counts need -profile_devices
+	bool const profiled = m_scheduler.profiling_devices();
+	writer.Key("profiled");
+	writer.Bool(profiled);
+	writer.Key("devices");
+	writer.StartArray();
+	for (device_scheduler::device_stats const &dev : m_scheduler.stats())
+	{
+		writer.StartObject();
+		writer.Key("tag");
+		writer.String(dev.device->device().tag());
+		writer.Key("cycles");
+		writer.Uint64(dev.cycles);
+		if (profiled)
+		{
+			writer.Key("timeslices");
+			writer.Uint64(dev.timeslices);
+			writer.Key("seconds");
+			writer.Double(dev.seconds);
+			writer.Key("aborts");
+			writer.Uint64(dev.aborts);
+			writer.Key("boosts");
+			writer.Uint64(dev.boosts);
+		}
+		writer.EndObject();
+	}
+	writer.EndArray();
+
+	// sound output, as of the most recent periodic update
+	writer.Key("sound");
+	writer.StartObject();
+	writer.Key("samples_last_update");
+	writer.Int(m_sound->sample_count());
+	writer.Key("muted");
+	writer.Bool(m_sound->muted());
+	writer.EndObject();
+	writer.EndObject();
+
+	std::atomic_store(&m_http_metrics, std::make_shared<std::string const>(s.GetString()));
+	m_http_metrics_ticks = now;
+	m_http_metrics_frames = frames;
+}
+
+//-------------------------------------------------
+//  serve_forks - listen on a local socket and
+//  fork a copy of the freshly reset machine for
+//  each job; the parent returns only to exit,
+//  each child returns to run its job
+//-------------------------------------------------
+
+void running_machine::serve_forks()
+{
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+	// only the forking thread survives in a job, so refuse to serve while
+	// anything else has started threads of its own; video and sound are
+	// OSD options, so look them up by name
+	auto const headless = [this] (char const *name)
+	{
+		char const *const value = options().value(name);
+		return value && !strcmp(value, "none");
+	};
+	if (!headless("video") || !headless("sound") || options().http())
+		throw emu_fatalerror("running_machine::serve_forks: fork server requires -video none -sound none and no -http");
+
+	char const *const path = options().fork_server();
+	sockaddr_un addr;
+	if (strlen(path) >= sizeof(addr.sun_path))
+		throw emu_fatalerror("running_machine::serve_forks: socket path %s is too long", path);
+
+	int const listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listener < 0)
+		throw emu_fatalerror("running_machine::serve_forks: unable to create socket");
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+	::unlink(path);
+	if ((::bind(listener, reinterpret_cast<sockaddr const *>(&addr), sizeof(addr)) < 0) || (::listen(listener, 16) < 0))
+	{
+		::close(listener);
+		throw emu_fatalerror("running_machine::serve_forks: unable to listen on %s", path);
+	}
+
+	// let the kernel reap finished jobs
+	std::signal(SIGCHLD, SIG_IGN);
+	osd_printf_info("Serving %s on %s\n", basename(), path);
+
+	while (true)
+	{
+		int const conn = ::accept(listener, nullptr, nullptr);
+		if (conn < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+
+		// each job is a single line: seconds of emulated time to run, or "quit"
+		std::string request;
+		char ch;
+		while ((::read(conn, &ch, 1) == 1) && (ch != '\n'))
+			request.push_back(ch);
+		request = std::string(strtrimspace(request));
+		if (request == "quit")
+		{
+			::close(conn);
+			break;
+		}
+
+		pid_t const pid = ::fork();
+		if (pid == 0)
+		{
+			// child: only the forking thread exists here, so give the work
+			// queues new workers, then report on the connection and run the
+			// job from here
+			m_fork_child = true;
+			osd_work_queue_restart_after_fork();
+			std::signal(SIGCHLD, SIG_DFL);
+			::close(listener);
+			::dup2(conn, STDOUT_FILENO);
+			::dup2(conn, STDERR_FILENO);
+			::close(conn);
+			int const seconds = atoi(request.c_str());
+			if (seconds > 0)
+				m_scheduler.timer_set(attotime::from_seconds(seconds), timer_expired_delegate(FUNC(running_machine::fork_job_expired), this));
+			return;
+		}
+
+		if (pid < 0)
+			osd_printf_error("running_machine::serve_forks: fork failed\n");
+		else
+			osd_printf_info("Started job %d (%s)\n", int(pid), request);
+		::close(conn);
+	}
+
+	// the server itself never runs the machine
+	::close(listener);
+	::unlink(path);
+	m_exit_pending = true;
+#else
+	throw emu_fatalerror("running_machine::serve_forks: fork server is not supported on this platform");
+#endif
+}
+
+
+//-------------------------------------------------
+//  fork_job_expired - a forked job has run for
+//  its requested time
+//-------------------------------------------------
+
+void running_machine::fork_job_expired(void *ptr, s32 param)
+{
+	schedule_exit();
+}
+
+
 //**************************************************************************
 //  SYSTEM TIME
 //**************************************************************************
@@ -225,6 +225,7 @@ public:
 	void set_ui_active(bool active) { m_ui_active = active; }
 	void debug_break();
 	void export_http_api();
+	void serve_forks();
 
 	// TODO: Do saves and loads still require scheduling?
 	void immediate_save(const char *filename);
@@ -299,7 +300,15 @@ private:
 	void start();
 	void set_saveload_filename(std::string &&filename);
 	void handle_saveload();
+	void report_saveload(save_error saverr, const char *opname, const char *opnamed);
+	void start_async_save(std::unique_ptr<emu_file> &&file);
+	void poll_async_saves();
+	void wait_async_saves();
+	void finish_async_saves();
+	static void *write_async_save(void *param, int threadid);
 	void soft_reset(void *ptr = nullptr, s32 param = 0);
+	void fork_job_expired(void *ptr, s32 param);
+	void publish_http_metrics();
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
 	void nvram_save();
@@ -344,6 +353,7 @@ private:
 	bool                    m_paused;               // paused?
 	bool                    m_hard_reset_pending;   // is a hard reset pending?
 	bool                    m_exit_pending;         // is an exit pending?
+	bool                    m_fork_child;           // are we a job forked by the fork server?
 	emu_timer *             m_soft_reset_timer;     // timer used to schedule a soft reset
 
 	// misc state
@@ -367,6 +377,23 @@ private:
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
 
+	// background save states
+	struct async_save
+	{
+		std::unique_ptr<emu_file> m_file;               // destination, opened on the emulation thread
+		std::vector<u8>         m_data;                 // state captured by write_buffer
+		std::string             m_filename;             // file name for reporting
+		save_error              m_error;                // result of the write
+		osd_work_item *         m_item;                 // work item doing the write
+	};
+	osd_work_queue *        m_save_queue;           // queue for background saves
+	std::vector<std::unique_ptr<async_save>> m_async_saves; // saves still being written
+
+	// metrics served over HTTP; built on the emulation thread and swapped in atomically
+	std::shared_ptr<std::string const> m_http_metrics;  // latest snapshot as JSON
+	osd_ticks_t             m_http_metrics_ticks;   // host time of the latest snapshot
+	u64                     m_http_metrics_frames;  // frame count at the latest snapshot
+
 	// notifier callbacks
 	struct notifier_callback_item
 	{
@@ -59,6 +59,7 @@ public:
 	static void periodic_check();
 	static bool frame_hook();
 	static void sound_hook();
+	static void state_saved_hook(const char *filename, bool success);
 	static void layout_script_cb(layout_file &file, const char *script);
 	static bool standalone();
 };
@@ -294,6 +294,9 @@ render_texture::render_texture()
 		m_format(TEXFORMAT_ARGB32),
 		m_id(~0ULL),
 		m_old_id(~0ULL),
+		m_explicit_update(false),
+		m_updated(true),
+		m_lookup_seqid(0),
 		m_scaler(nullptr),
 		m_param(nullptr),
 		m_curseq(0)
@@ -329,6 +332,8 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 	}
 	m_old_id = m_id;
 	m_id = ~0L;
+	m_explicit_update = false;
+	m_updated = true;
 }
 
 
@@ -375,6 +380,7 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	m_bitmap = &bitmap;
 	m_sbounds = sbounds;
 	m_format = format;
+	m_updated = true;
 
 	// invalidate all scaled versions
 	for (auto & elem : m_scaled)
@@ -430,8 +436,11 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.rowpixels = m_bitmap->rowpixels();
 		texinfo.width = swidth;
 		texinfo.height = sheight;
-		// palette will be set later
-		texinfo.seqid = ++m_curseq;
+		// palette will be set later; paletted contents can change without the bitmap changing
+		if (m_updated || !m_explicit_update || (m_format == TEXFORMAT_PALETTE16) || (m_curseq == 0))
+			++m_curseq;
+		texinfo.seqid = m_curseq;
+		m_updated = false;
 	}
 	else
 	{
@@ -540,6 +549,7 @@ render_container::render_container(render_manager &manager, screen_device *scree
 	, m_screen(screen)
 	, m_overlaybitmap(nullptr)
 	, m_overlaytexture(nullptr)
+	, m_lookup_seqid(0)
 {
 	// make sure it is empty
 	empty();
@@ -772,6 +782,8 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 
 void render_container::recompute_lookups()
 {
+	m_lookup_seqid++;
+
 	// recompute the 256 entry lookup table
 	for (int i = 0; i < 0x100; i++)
 	{
@@ -2364,6 +2376,8 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					width = std::min(width, m_maxtexwidth);
 					height = std::min(height, m_maxtexheight);
 
+					// brightness/contrast/gamma changes alter the texture even if its bitmap didn't change
+					curitem.texture()->set_lookup_seqid(container.lookup_seqid());
 					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
 
 					// set the palette
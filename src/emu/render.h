@@ -339,6 +339,9 @@ public:
 	// set a unique identifier
 	void set_id(u64 id) { m_old_id = m_id; m_id = id; }
 
+	// only report new RGB contents after set_bitmap, so unchanged frames aren't uploaded again
+	void set_explicit_update(bool explicit_update) { m_explicit_update = explicit_update; }
+
 	// generic high-quality bitmap scaler
 	static void hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
@@ -346,6 +349,7 @@ private:
 	// internal helpers
 	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
 	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
+	void set_lookup_seqid(u32 seqid) { if (seqid != m_lookup_seqid) { m_lookup_seqid = seqid; m_updated = true; } }
 
 	static const int MAX_TEXTURE_SCALES = 16;
 
@@ -364,6 +368,9 @@ private:
 	texture_format      m_format;                   // format of the texture data
 	u64                 m_id;                       // unique id to pass to osd
 	u64                 m_old_id;                   // previous id, if applicable
+	bool                m_explicit_update;          // contents only change when set_bitmap is called
+	bool                m_updated;                  // set_bitmap called since the last get_scaled
+	u32                 m_lookup_seqid;             // container lookup sequence number at the last get_scaled
 
 	// scaling state (ARGB32 only)
 	texture_scaler_func m_scaler;                   // scaling callback
@@ -433,6 +440,7 @@ public:
 	void add_rect(float x0, float y0, float x1, float y1, rgb_t argb, u32 flags) { add_quad(x0, y0, x1, y1, argb, nullptr, flags); }
 
 	// brightness/contrast/gamma helpers
+	u32 lookup_seqid() const { return m_lookup_seqid; }
 	bool has_brightness_contrast_gamma_changes() const { return (m_user.m_brightness != 1.0f || m_user.m_contrast != 1.0f || m_user.m_gamma != 1.0f); }
 	u8 apply_brightness_contrast_gamma(u8 value);
 	float apply_brightness_contrast_gamma_fp(float value);
@@ -491,6 +499,7 @@ private:
 	std::unique_ptr<palette_client> m_palclient;    // client to the screen palette
 	std::vector<rgb_t>      m_bcglookup;            // copy of screen palette with bcg adjustment
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
+	u32                     m_lookup_seqid;         // incremented whenever the lookup tables are recomputed
 };
 
 
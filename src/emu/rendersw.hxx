@@ -28,6 +28,20 @@ private:
 		s32 endx, endy;
 	};
 
+	// a horizontal band of the destination rendered by one work item
+	struct band_data
+	{
+		const render_primitive_list *primlist;
+		_PixelType *dstdata;
+		u32 width;
+		u32 pitch;
+		s32 top, bottom;
+	};
+
+	// bands per parallel render, and the smallest band worth a thread
+	static constexpr int RENDER_BANDS = 8;
+	static constexpr int RENDER_BAND_MIN_HEIGHT = 32;
+
 	// internal helpers
 	static constexpr bool is_opaque(float alpha) { return (alpha >= (_NoDestRead ? 0.5f : 1.0f)); }
 	static constexpr bool is_transparent(float alpha) { return (alpha < (_NoDestRead ? 0.5f : 0.0001f)); }
@@ -498,7 +512,7 @@ private:
 	//  draw_rect - draw a solid rectangle
 	//-------------------------------------------------
 
-	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 top, s32 bottom, u32 pitch)
 	{
 		render_bounds fpos = prim.bounds;
 		assert(fpos.x0 <= fpos.x1);
@@ -515,10 +529,10 @@ private:
 		if (startx >= width) startx = width;
 		if (endx < 0) endx = 0;
 		if (endx >= width) endx = width;
-		if (starty < 0) starty = 0;
-		if (starty >= height) starty = height;
-		if (endy < 0) endy = 0;
-		if (endy >= height) endy = height;
+		if (starty < top) starty = top;
+		if (starty >= bottom) starty = bottom;
+		if (endy < top) endy = top;
+		if (endy >= bottom) endy = bottom;
 
 		// bail if nothing left
 		if (fpos.x0 > fpos.x1 || fpos.y0 > fpos.y1)
@@ -1697,7 +1711,7 @@ private:
 	//  drawing routine
 	//-------------------------------------------------
 
-	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 top, s32 bottom, u32 pitch)
 	{
 		assert(prim.bounds.x0 <= prim.bounds.x1);
 		assert(prim.bounds.y0 <= prim.bounds.y1);
@@ -1715,15 +1729,14 @@ private:
 		setup.endx = round_nearest(prim.bounds.x1);
 		setup.endy = round_nearest(prim.bounds.y1);
 
-		// ensure we fit
+		// ensure we fit horizontally
 		if (setup.startx < 0) setup.startx = 0;
 		if (setup.startx >= width) setup.startx = width;
 		if (setup.endx < 0) setup.endx = 0;
 		if (setup.endx >= width) setup.endx = width;
 		if (setup.starty < 0) setup.starty = 0;
-		if (setup.starty >= height) setup.starty = height;
 		if (setup.endy < 0) setup.endy = 0;
-		if (setup.endy >= height) setup.endy = height;
+		s32 const firsty = setup.starty;
 
 		// compute start and delta U,V coordinates now
 		setup.dudx = round_nearest(65536.0f * float(prim.texture.width) * fdudx);
@@ -1744,6 +1757,14 @@ private:
 			setup.startv -= 0x8000;
 		}
 
+		// clip vertically to the band, stepping U/V down to the first row we draw
+		if (setup.starty < top) setup.starty = top;
+		if (setup.starty >= bottom) setup.starty = bottom;
+		if (setup.endy < top) setup.endy = top;
+		if (setup.endy >= bottom) setup.endy = bottom;
+		setup.startu += (setup.starty - firsty) * setup.dudy;
+		setup.startv += (setup.starty - firsty) * setup.dvdy;
+
 		// render based on the texture coordinates
 		switch (prim.flags & (PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK))
 		{
@@ -1805,25 +1826,70 @@ private:
 	//-------------------------------------------------
 
 public:
-	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch, osd_work_queue *queue = nullptr)
+	{
+		// split into bands if we were given a queue, unless there are lines, which can't be clipped to a band
+		int const bands = (std::min)(RENDER_BANDS, int(height) / RENDER_BAND_MIN_HEIGHT);
+		bool banded = (queue != nullptr) && (bands > 1);
+		for (const render_primitive *prim = primlist.first(); banded && (prim != nullptr); prim = prim->next())
+			if (prim->type == render_primitive::LINE)
+				banded = false;
+
+		if (!banded)
+		{
+			draw_band(primlist, reinterpret_cast<_PixelType *>(dstdata), width, 0, height, pitch);
+			return;
+		}
+
+		// each band gets an even share of the rows, with the remainder in the last
+		band_data band[RENDER_BANDS];
+		s32 const bandheight = height / bands;
+		for (int index = 0; index < bands; index++)
+		{
+			band[index].primlist = &primlist;
+			band[index].dstdata = reinterpret_cast<_PixelType *>(dstdata);
+			band[index].width = width;
+			band[index].pitch = pitch;
+			band[index].top = index * bandheight;
+			band[index].bottom = (index == (bands - 1)) ? s32(height) : ((index + 1) * bandheight);
+		}
+		osd_work_item_queue_multiple(queue, &software_renderer::draw_band_callback, bands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second() * 10)) { }
+	}
+
+private:
+	//-------------------------------------------------
+	//  draw_band - draw every primitive clipped to
+	//  the rows from top up to but not including
+	//  bottom
+	//-------------------------------------------------
+
+	static void draw_band(const render_primitive_list &primlist, _PixelType *dstdata, u32 width, s32 top, s32 bottom, u32 pitch)
 	{
 		// loop over the list and render each element
 		for (const render_primitive *prim = primlist.first(); prim != nullptr; prim = prim->next())
 			switch (prim->type)
 			{
 				case render_primitive::LINE:
-					draw_line(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+					draw_line(*prim, dstdata, width, bottom, pitch);
 					break;
 
 				case render_primitive::QUAD:
 					if (!prim->texture.base)
-						draw_rect(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+						draw_rect(*prim, dstdata, width, top, bottom, pitch);
 					else
-						setup_and_draw_textured_quad(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+						setup_and_draw_textured_quad(*prim, dstdata, width, top, bottom, pitch);
 					break;
 
 				default:
 					throw emu_fatalerror("Unexpected render_primitive type");
 			}
 	}
+
+	static void *draw_band_callback(void *param, int threadid)
+	{
+		band_data const &band = *reinterpret_cast<band_data const *>(param);
+		draw_band(*band.primlist, band.dstdata, band.width, band.top, band.bottom, band.pitch);
+		return nullptr;
+	}
 };
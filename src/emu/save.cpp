@@ -98,6 +98,7 @@ void save_manager::allow_registration(bool allowed)
 			fatalerror("%d duplicate save state entries found.\n", dupes_found);
 
 		dump_registry();
+		build_run_list();
 
 		// everything is registered by now, evaluate the savestate size
 		m_rewind->clamp_capacity();
@@ -353,6 +354,30 @@ save_error save_manager::write_buffer(void *buf, size_t size)
 }
 
 
+//-------------------------------------------------
+//  write_buffer_to_file - write a state captured
+//  by write_buffer to a file; this doesn't touch
+//  the machine, so may be called from any thread
+//-------------------------------------------------
+
+save_error save_manager::write_buffer_to_file(emu_file &file, const void *buf, size_t size)
+{
+	const u8 *const data = reinterpret_cast<const u8 *>(buf);
+	if (size < HEADER_SIZE)
+		return STATERR_WRITE_ERROR;
+
+	// the header is stored uncompressed, like write_file
+	file.compress(FCOMPRESS_NONE);
+	file.seek(0, SEEK_SET);
+	if (file.write(data, HEADER_SIZE) != HEADER_SIZE)
+		return STATERR_WRITE_ERROR;
+	file.compress(FCOMPRESS_MEDIUM);
+	if (file.write(data + HEADER_SIZE, size - HEADER_SIZE) != (size - HEADER_SIZE))
+		return STATERR_WRITE_ERROR;
+	return STATERR_NONE;
+}
+
+
 //-------------------------------------------------
 //  read_buffer - restore the machine state from a
 //  buffer
@@ -412,14 +437,9 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 	dispatch_presave();
 
 	// then write all the data
-	for (auto &entry : m_entry_list)
-	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		const u8 *data = reinterpret_cast<const u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
-			if (!write_block(data, blocksize))
-				return STATERR_WRITE_ERROR;
-	}
+	for (const state_run &run : m_run_list)
+		if (!write_block(run.m_data, run.m_size))
+			return STATERR_WRITE_ERROR;
 	return STATERR_NONE;
 }
 
@@ -455,17 +475,15 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 	// determine whether or not to flip the data when done
 	const bool flip = NATIVE_ENDIAN_VALUE_LE_BE((header[9] & SS_MSB_FIRST) != 0, (header[9] & SS_MSB_FIRST) == 0);
 
-	// read all the data, flipping if necessary
-	for (auto &entry : m_entry_list)
-	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		u8 *data = reinterpret_cast<u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
-			if (!read_block(data, blocksize))
-				return STATERR_READ_ERROR;
+	// read all the data
+	for (const state_run &run : m_run_list)
+		if (!read_block(run.m_data, run.m_size))
+			return STATERR_READ_ERROR;
 
-		// handle flipping
-		if (flip)
+	// handle flipping
+	if (flip)
+	{
+		for (state_entry *entry : m_flip_list)
 			entry->flip_data();
 	}
 
@@ -514,6 +532,39 @@ void save_manager::dump_registry() const
 }
 
 
+//-------------------------------------------------
+//  build_run_list - coalesce the blocks of all
+//  entries into contiguous spans, in the order
+//  they appear in the state, so serialisation
+//  can transfer them in as few calls as possible
+//-------------------------------------------------
+
+void save_manager::build_run_list()
+{
+	m_run_list.clear();
+	m_flip_list.clear();
+	for (auto &entry : m_entry_list)
+	{
+		const u32 blocksize = entry->m_typesize * entry->m_typecount;
+		u8 *data = reinterpret_cast<u8 *>(entry->m_data);
+		if (blocksize)
+		{
+			for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
+			{
+				if (!m_run_list.empty() && ((m_run_list.back().m_data + m_run_list.back().m_size) == data))
+					m_run_list.back().m_size += blocksize;
+				else
+					m_run_list.push_back(state_run{ data, blocksize });
+			}
+		}
+
+		// single-byte items never need swapping
+		if (entry->m_typesize > 1)
+			m_flip_list.push_back(entry.get());
+	}
+}
+
+
 //-------------------------------------------------
 //  validate_header - validate the data in the
 //  header
@@ -660,6 +711,7 @@ rewinder::rewinder(save_manager &save)
 	, m_first_invalid_index(REWIND_INDEX_NONE)
 	, m_first_time_warning(true)
 	, m_first_time_note(true)
+	, m_total_size(0)
 {
 }
 
@@ -711,7 +763,7 @@ void rewinder::invalidate()
 
 		// actually invalidate
 		for (auto it = m_state_list.begin() + m_first_invalid_index; it < m_state_list.end(); ++it)
-			it->get()->m_valid = false;
+			it->m_valid = false;
 	}
 }
 
@@ -729,51 +781,50 @@ bool rewinder::capture()
 		return false;
 	}
 
-	if (current_index_is_last())
+	// serialize the machine
+	m_scratch.resize(ram_state::get_size(m_save));
+	const save_error error = m_save.write_buffer(&m_scratch[0], m_scratch.size());
+	if (error != STATERR_NONE)
 	{
-		// we need to create a new state
-		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
-		const save_error error = state->save();
-
-		// validate the state
-		if (error == STATERR_NONE)
-			// it's safe to append
-			m_state_list.push_back(std::move(state));
-		else
-		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
-		}
+		// internal error, complain and evacuate
+		report_error(error, rewind_operation::SAVE);
+		return false;
 	}
-	else
-	{
-		// invalidate the future states
-		invalidate();
-
-		// update the existing state
-		ram_state *state = m_state_list.at(m_current_index).get();
-		const save_error error = state->save();
 
-		// validate the state
-		if (error != STATERR_NONE)
-		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
-		}
+	// when capturing after stepping back, the current state and the future ones are replaced
+	if (!current_index_is_last())
+	{
+		for (auto it = m_state_list.begin() + m_current_index; it < m_state_list.end(); ++it)
+			m_total_size -= it->m_data.size();
+		m_state_list.erase(m_state_list.begin() + m_current_index, m_state_list.end());
+		m_last_state.clear();
+		if (!m_state_list.empty())
+			materialize(m_state_list.size() - 1, m_last_state);
 	}
 
-	// make sure we will fit in
-	if (!check_size())
-		// the list keeps growing
-		m_current_index++;
-
-	// update first invalid index
-	if (current_index_is_last())
-		m_first_invalid_index = REWIND_INDEX_NONE;
+	// store a keyframe periodically, otherwise the difference from the previous state
+	rewind_state state;
+	state.m_valid = true;
+	state.m_time = m_save.machine().time();
+	state.m_keyframe = m_state_list.empty() || (m_state_list.back().m_chain + 1 >= KEYFRAME_INTERVAL) || (m_last_state.size() != m_scratch.size());
+	if (state.m_keyframe)
+	{
+		state.m_chain = 0;
+		state.m_data = m_scratch;
+	}
 	else
-		m_first_invalid_index = m_current_index + 1;
+	{
+		state.m_chain = m_state_list.back().m_chain + 1;
+		encode_delta(m_last_state, m_scratch, state.m_data);
+	}
+	m_total_size += state.m_data.size();
+	m_state_list.push_back(std::move(state));
+	m_last_state.swap(m_scratch);
+
+	// make sure we fit in, and point at the new state
+	check_size();
+	m_current_index = m_state_list.size() - 1;
+	m_first_invalid_index = REWIND_INDEX_NONE;
 
 	// success
 	report_error(STATERR_NONE, rewind_operation::SAVE);
@@ -806,11 +857,11 @@ bool rewinder::step()
 	if (m_first_invalid_index > REWIND_INDEX_NONE && m_current_index > m_first_invalid_index)
 		m_current_index = m_first_invalid_index;
 
-	// step back and obtain the state pointer
-	ram_state *state = m_state_list.at(--m_current_index).get();
+	// step back and rebuild the full state from the nearest keyframe
+	materialize(--m_current_index, m_scratch);
 
 	// try to load and report the result
-	const save_error error = state->load();
+	const save_error error = m_save.read_buffer(&m_scratch[0], m_scratch.size());
 	report_error(error, rewind_operation::LOAD);
 
 	if (error == save_error::STATERR_NONE)
@@ -821,64 +872,123 @@ bool rewinder::step()
 
 
 //-------------------------------------------------
-//  check_size - shrink the state list if it is
-//  about to hit the capacity. returns true if
-//  the list got shrank
+//  check_size - drop the oldest states while the
+//  list is over capacity, promoting the next
+//  state to a keyframe when needed
 //-------------------------------------------------
 
-bool rewinder::check_size()
+void rewinder::check_size()
 {
-	if (!m_enabled)
-		return false;
-
-	// state sizes in bytes
-	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
-
 	// convert our limit from megabytes
 	const size_t capsize = m_capacity * 1024 * 1024;
 
-	// safety check that shouldn't be allowed to trigger
-	if (totalsize > capsize)
-	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
-
-		// drop everything that's beyond capacity
-		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
-	}
-
-	// update before new check
-	totalsize = m_state_list.size() * singlesize;
-
-	// check if capacity will be hit by the newly captured state
-	if (totalsize + singlesize >= capsize)
+	while (m_total_size > capsize && m_state_list.size() > 1)
 	{
-		// check if we have spare states ahead
-		if (!current_index_is_last())
-			// no need to move states around
-			return false;
-
-		// we can now get the first state and invalidate it
-		std::unique_ptr<ram_state> first(std::move(m_state_list.front()));
-		first->m_valid = false;
+		// the oldest state is always a keyframe, so the next one becomes one
+		rewind_state &next = m_state_list[1];
+		if (!next.m_keyframe)
+		{
+			std::vector<u8> full(m_state_list.front().m_data);
+			apply_delta(full, next.m_data);
+			m_total_size += full.size() - next.m_data.size();
+			next.m_data.swap(full);
+			next.m_keyframe = true;
+
+			// keep the chain lengths consistent up to the following keyframe
+			const u32 chain = next.m_chain;
+			for (auto it = m_state_list.begin() + 1; (it < m_state_list.end()) && ((it == m_state_list.begin() + 1) || !it->m_keyframe); ++it)
+				it->m_chain -= chain;
+		}
 
-		// move it to the end for future use
-		m_state_list.push_back(std::move(first));
+		m_total_size -= m_state_list.front().m_data.size();
 		m_state_list.erase(m_state_list.begin());
 
 		if (m_first_time_note)
 		{
 			m_save.machine().logerror("Rewind note: Capacity has been reached. Old savestates will be erased.\n");
 			m_save.machine().logerror("Capacity: %d bytes. Savestate size: %d bytes. Savestate count: %d.\n",
-				totalsize, singlesize, m_state_list.size());
+				capsize, m_last_state.size(), m_state_list.size());
 			m_first_time_note = false;
 		}
+	}
+}
 
-		return true;
+
+//-------------------------------------------------
+//  materialize - rebuild the full data of a
+//  state from the keyframe before it
+//-------------------------------------------------
+
+void rewinder::materialize(s32 index, std::vector<u8> &data) const
+{
+	s32 keyframe = index;
+	while (!m_state_list[keyframe].m_keyframe)
+		keyframe--;
+
+	data = m_state_list[keyframe].m_data;
+	while (keyframe < index)
+		apply_delta(data, m_state_list[++keyframe].m_data);
+}
+
+
+//-------------------------------------------------
+//  encode_delta - store the bytes that differ
+//  between two states as runs of (skip, length,
+//  XOR data)
+//-------------------------------------------------
+
+void rewinder::encode_delta(const std::vector<u8> &base, const std::vector<u8> &state, std::vector<u8> &delta)
+{
+	const size_t size = state.size();
+	const u8 *const src = &state[0];
+	const u8 *const ref = &base[0];
+
+	delta.clear();
+	size_t pos = 0;
+	while (pos < size)
+	{
+		// skip identical data a word at a time
+		const size_t start = pos;
+		while ((pos + 8) <= size && !memcmp(&src[pos], &ref[pos], 8))
+			pos += 8;
+		while (pos < size && src[pos] == ref[pos])
+			pos++;
+		if (pos == size)
+			break;
+
+		// then collect words until they match again
+		const size_t literal = pos;
+		do
+			pos = std::min<size_t>(pos + 8, size);
+		while (pos < size && memcmp(&src[pos], &ref[pos], std::min<size_t>(8, size - pos)));
+
+		const u32 header[2] = { u32(literal - start), u32(pos - literal) };
+		const size_t out = delta.size();
+		delta.resize(out + sizeof(header) + (pos - literal));
+		memcpy(&delta[out], header, sizeof(header));
+		for (size_t i = literal; i < pos; i++)
+			delta[out + sizeof(header) + i - literal] = src[i] ^ ref[i];
 	}
+}
 
-	return false;
+
+//-------------------------------------------------
+//  apply_delta - XOR a delta into a state; this
+//  turns either end of the delta into the other
+//-------------------------------------------------
+
+void rewinder::apply_delta(std::vector<u8> &state, const std::vector<u8> &delta)
+{
+	size_t pos = 0;
+	for (size_t in = 0; in < delta.size(); )
+	{
+		u32 header[2];
+		memcpy(header, &delta[in], sizeof(header));
+		in += sizeof(header);
+		pos += header[0];
+		for (u32 i = 0; i < header[1]; i++)
+			state[pos++] ^= delta[in++];
+	}
 }
 
 
@@ -124,6 +124,13 @@ class save_manager
 		u32             m_stride;               // stride between blocks of items in units of item size
 	};
 
+	// contiguous span of memory covering one or more consecutive entry blocks
+	struct state_run
+	{
+		u8 *            m_data;                 // start of the span
+		size_t          m_size;                 // length in bytes
+	};
+
 	friend class ram_state;
 	friend class rewinder;
 
@@ -291,6 +298,7 @@ public:
 
 	save_error write_buffer(void *buf, size_t size);
 	save_error read_buffer(const void *buf, size_t size);
+	static save_error write_buffer_to_file(emu_file &file, const void *buf, size_t size);
 
 private:
 	// state callback item
@@ -310,6 +318,7 @@ private:
 	save_error do_read(T check_length, U read_block, V start_header, W start_data);
 	u32 signature() const;
 	void dump_registry() const;
+	void build_run_list();
 	static save_error validate_header(const u8 *header, const char *gamename, u32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
 
 	// internal state
@@ -319,6 +328,8 @@ private:
 	s32                       m_illegal_regs;         // number of illegal registrations
 
 	std::vector<std::unique_ptr<state_entry>>    m_entry_list;       // list of registered entries
+	std::vector<state_run>                       m_run_list;         // entry data coalesced into contiguous spans
+	std::vector<state_entry *>                   m_flip_list;        // entries that need byte swapping on endian mismatch
 	std::vector<std::unique_ptr<ram_state>>      m_ramstate_list;    // list of ram states
 	std::vector<std::unique_ptr<state_callback>> m_presave_list;     // list of pre-save functions
 	std::vector<std::unique_ptr<state_callback>> m_postload_list;    // list of post-load functions
@@ -348,7 +359,23 @@ class rewinder
 	s32            m_first_invalid_index;             // all states before this one are guarateed to be valid
 	bool           m_first_time_warning;              // keep track of warnings we report
 	bool           m_first_time_note;                 // keep track of notes
-	std::vector<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states
+
+	// states are kept as XOR/RLE deltas against the previous one, with periodic keyframes
+	static constexpr u32 KEYFRAME_INTERVAL = 32;
+
+	struct rewind_state
+	{
+		std::vector<u8> m_data;                        // full state for keyframes, delta from the previous state otherwise
+		attotime        m_time;                        // machine timestamp
+		u32             m_chain;                       // deltas since the last keyframe
+		bool            m_keyframe;                    // is m_data a full state?
+		bool            m_valid;                       // can we load this state?
+	};
+
+	std::vector<rewind_state> m_state_list;            // rewinder's own states
+	std::vector<u8> m_last_state;                     // full data of the newest state
+	std::vector<u8> m_scratch;                        // buffer for captures and loads
+	size_t          m_total_size;                     // bytes held by the state list
 
 	// load/save management
 	enum class rewind_operation
@@ -363,9 +390,12 @@ class rewinder
 		REWIND_INDEX_FIRST
 	};
 
-	bool check_size();
+	void check_size();
 	bool current_index_is_last() { return m_current_index == m_state_list.size() - 1; }
 	void report_error(save_error type, rewind_operation operation);
+	void materialize(s32 index, std::vector<u8> &data) const;
+	static void encode_delta(const std::vector<u8> &base, const std::vector<u8> &state, std::vector<u8> &delta);
+	static void apply_delta(std::vector<u8> &state, const std::vector<u8> &delta);
 
 public:
 	rewinder(save_manager &save);
@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
 
 //**************************************************************************
 //  DEBUGGING
@@ -47,7 +48,8 @@ enum
 emu_timer::emu_timer() :
 	m_machine(nullptr),
 	m_next(nullptr),
-	m_prev(nullptr),
+	m_heap_index(0),
+	m_sequence(0),
 	m_param(0),
 	m_ptr(nullptr),
 	m_enabled(false),
@@ -80,7 +82,6 @@ inline emu_timer &emu_timer::init(running_machine &machine, timer_expired_delega
 	// ensure the entire timer state is clean
 	m_machine = &machine;
 	m_next = nullptr;
-	m_prev = nullptr;
 	m_callback = callback;
 	m_param = 0;
 	m_ptr = ptr;
@@ -112,7 +113,6 @@ inline emu_timer &emu_timer::init(device_t &device, device_timer_id id, void *pt
 	// ensure the entire timer state is clean
 	m_machine = &device.machine();
 	m_next = nullptr;
-	m_prev = nullptr;
 	m_callback = timer_expired_delegate(FUNC(emu_timer::device_timer_expired), this);
 	m_param = 0;
 	m_ptr = ptr;
@@ -244,7 +244,7 @@ void emu_timer::register_save()
 	{
 		// for non-device timers, it is an index based on the callback function name
 		name = m_callback.name() ? m_callback.name() : "unnamed";
-		for (emu_timer *curtimer = machine().scheduler().first_timer(); curtimer != nullptr; curtimer = curtimer->next())
+		for (emu_timer *curtimer : machine().scheduler().m_timer_heap)
 			if (!curtimer->m_temporary && curtimer->m_device == nullptr)
 			{
 				if (curtimer->m_callback.name() != nullptr && m_callback.name() != nullptr && strcmp(curtimer->m_callback.name(), m_callback.name()) == 0)
@@ -257,7 +257,7 @@ void emu_timer::register_save()
 	{
 		// for device timers, it is an index based on the device and timer ID
 		name = string_format("%s/%d", m_device->tag(), m_id);
-		for (emu_timer *curtimer = machine().scheduler().first_timer(); curtimer != nullptr; curtimer = curtimer->next())
+		for (emu_timer *curtimer : machine().scheduler().m_timer_heap)
 			if (!curtimer->m_temporary && curtimer->m_device == m_device && curtimer->m_id == m_id)
 				index++;
 	}
@@ -332,16 +332,17 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_executing_device(nullptr),
 	m_execute_list(nullptr),
 	m_basetime(attotime::zero),
-	m_timer_list(nullptr),
+	m_timer_sequence(0),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
-	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
+	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000),
+	m_profile_devices(machine.options().profile_devices()),
+	m_stat_boosts(0)
 {
 	// append a single never-expiring timer so there is always one in the list
-	m_timer_list = &m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true);
-	m_timer_list->adjust(attotime::never);
+	m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true).adjust(attotime::never);
 
 	// register global states
 	machine.save().save_item(NAME(m_basetime));
@@ -357,8 +358,8 @@ device_scheduler::device_scheduler(running_machine &machine) :
 device_scheduler::~device_scheduler()
 {
 	// remove all timers
-	while (m_timer_list != nullptr)
-		m_timer_allocator.reclaim(m_timer_list->release());
+	while (!m_timer_heap.empty())
+		m_timer_allocator.reclaim(m_timer_heap.back()->release());
 }
 
 
@@ -374,7 +375,8 @@ attotime device_scheduler::time() const noexcept
 
 	// if we're executing as a particular CPU, use its local time as a base
 	// otherwise, return the global base time
-	return (m_executing_device != nullptr) ? m_executing_device->local_time() : m_basetime;
+	device_execute_interface *const executing = currently_executing();
+	return (executing != nullptr) ? executing->local_time() : m_basetime;
 }
 
 
@@ -386,7 +388,7 @@ attotime device_scheduler::time() const noexcept
 bool device_scheduler::can_save() const
 {
 	// if any live temporary timers exit, fail
-	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = timer->next())
+	for (emu_timer *timer : m_timer_heap)
 		if (timer->m_temporary && !timer->expire().is_never())
 		{
 			machine().logerror("Failed save state attempt due to anonymous timers:\n");
@@ -441,14 +443,14 @@ void device_scheduler::timeslice()
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	while (m_basetime < first_timer()->m_expire)
 	{
 		// by default, assume our target is the end of the next quantum
 		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (first_timer()->m_expire < target)
+			target = first_timer()->m_expire;
 
 		LOG("------------------\n");
 		LOG("cpu_timeslice: target = %s\n", target.as_string(PRECISION));
@@ -457,91 +459,111 @@ void device_scheduler::timeslice()
 		if (m_suspend_changes_pending)
 			apply_suspend_changes();
 
-		// loop over all CPUs
-		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
-		{
-			// only process if this CPU is executing or truly halted (not yielding)
-			// and if our target is later than the CPU's current time (coarse check)
-			if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
-			{
-				// compute how many attoseconds to execute this CPU
-				attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
-				if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
-					delta += ATTOSECONDS_PER_SECOND;
-				assert(delta == (target - exec->m_localtime).as_attoseconds());
+		// run all devices
+		target = execute_devices(target, call_debugger);
 
-				if (exec->m_attoseconds_per_cycle == 0)
-				{
-					exec->m_localtime = target;
-				}
-				// if we have enough for at least 1 cycle, do the math
-				else if (delta >= exec->m_attoseconds_per_cycle)
-				{
-					// compute how many cycles we want to execute
-					int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
-					LOG("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running);
+		// update the base time
+		m_basetime = target;
+	}
 
-					// if we're not suspended, actually execute
-					if (exec->m_suspend == 0)
-					{
-						g_profiler.start(exec->m_profiler);
-
-						// note that this global variable cycles_stolen can be modified
-						// via the call to cpu_execute
-						exec->m_cycles_stolen = 0;
-						m_executing_device = exec;
-						*exec->m_icountptr = exec->m_cycles_running;
-						if (!call_debugger)
-							exec->run();
-						else
-						{
-							exec->debugger_start_cpu_hook(target);
-							exec->run();
-							exec->debugger_stop_cpu_hook();
-						}
-
-						// adjust for any cycles we took back
-						assert(ran >= *exec->m_icountptr);
-						ran -= *exec->m_icountptr;
-						assert(ran >= exec->m_cycles_stolen);
-						ran -= exec->m_cycles_stolen;
-						g_profiler.stop();
-					}
+	// execute timers
+	execute_timers();
+}
+
+
+//-------------------------------------------------
+//  execute_devices - run a list of devices up to
+//  the target time, returning the earliest time
+//  reached by any of them
+//-------------------------------------------------
+
+inline attotime device_scheduler::execute_devices(attotime target, bool call_debugger)
+{
+	// loop over all CPUs
+	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+	{
+		// only process if this CPU is executing or truly halted (not yielding)
+		// and if our target is later than the CPU's current time (coarse check)
+		if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
+		{
+			// compute how many attoseconds to execute this CPU
+			attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
+			if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
+				delta += ATTOSECONDS_PER_SECOND;
+			assert(delta == (target - exec->m_localtime).as_attoseconds());
 
-					// account for these cycles
-					exec->m_totalcycles += ran;
+			if (exec->m_attoseconds_per_cycle == 0)
+			{
+				exec->m_localtime = target;
+			}
+			// if we have enough for at least 1 cycle, do the math
+			else if (delta >= exec->m_attoseconds_per_cycle)
+			{
+				// compute how many cycles we want to execute
+				int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
+				LOG("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running);
 
-					// update the local time for this CPU
-					attotime deltatime;
-					if (ran < exec->m_cycles_per_second)
-						deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
+				// if we're not suspended, actually execute
+				if (exec->m_suspend == 0)
+				{
+					g_profiler.start(exec->m_profiler);
+					const osd_ticks_t start = UNEXPECTED(m_profile_devices) ? osd_ticks() : 0;
+
+					// note that this global variable cycles_stolen can be modified
+					// via the call to cpu_execute
+					exec->m_cycles_stolen = 0;
+					m_executing_device = exec;
+					*exec->m_icountptr = exec->m_cycles_running;
+					if (!call_debugger)
+						exec->run();
 					else
 					{
-						u32 remainder;
-						s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, remainder);
-						deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
+						exec->debugger_start_cpu_hook(target);
+						exec->run();
+						exec->debugger_stop_cpu_hook();
 					}
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
-					LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
 
-					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
+					// adjust for any cycles we took back
+					assert(ran >= *exec->m_icountptr);
+					ran -= *exec->m_icountptr;
+					assert(ran >= exec->m_cycles_stolen);
+					ran -= exec->m_cycles_stolen;
+					if (UNEXPECTED(m_profile_devices))
 					{
-						target = std::max(exec->m_localtime, m_basetime);
-						LOG("         (new target)\n");
+						exec->m_stat_ticks += osd_ticks() - start;
+						exec->m_stat_timeslices++;
 					}
+					g_profiler.stop();
+				}
+
+				// account for these cycles
+				exec->m_totalcycles += ran;
+
+				// update the local time for this CPU
+				attotime deltatime;
+				if (ran < exec->m_cycles_per_second)
+					deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
+				else
+				{
+					u32 remainder;
+					s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, remainder);
+					deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
+				}
+				assert(deltatime >= attotime::zero);
+				exec->m_localtime += deltatime;
+				LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
+
+				// if the new local CPU time is less than our target, move the target up, but not before the base
+				if (exec->m_localtime < target)
+				{
+					target = std::max(exec->m_localtime, m_basetime);
+					LOG("         (new target)\n");
 				}
 			}
 		}
-		m_executing_device = nullptr;
-
-		// update the base time
-		m_basetime = target;
 	}
-
-	// execute timers
-	execute_timers();
+	m_executing_device = nullptr;
+	return target;
 }
 
 
@@ -588,6 +610,15 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 	// ignore timeslices > 1 second
 	if (timeslice_time.seconds() > 0)
 		return;
+
+	// note who asked for it
+	if (UNEXPECTED(m_profile_devices))
+	{
+		m_stat_boosts++;
+		device_execute_interface *const executing = currently_executing();
+		if (executing != nullptr)
+			executing->m_stat_boosts++;
+	}
 	add_scheduling_quantum(timeslice_time, boost_duration);
 }
 
@@ -681,26 +712,20 @@ void device_scheduler::presave()
 
 void device_scheduler::postload()
 {
-	// remove all timers and make a private list of permanent ones
-	simple_list<emu_timer> private_list;
-	while (m_timer_list != nullptr)
-	{
-		emu_timer &timer = *m_timer_list;
+	// take all timers out of the heap, keeping them in their current order
+	std::vector<emu_timer *> timers(m_timer_heap.release());
+	std::sort(timers.begin(), timers.end(), [] (emu_timer const *a, emu_timer const *b) { return timer_precedes(*a, *b); });
 
-		// temporary timers go away entirely (except our special never-expiring one)
-		if (timer.m_temporary && !timer.expire().is_never())
-			m_timer_allocator.reclaim(timer.release());
-
-		// permanent ones get added to our private list
+	// temporary timers go away entirely (except our special never-expiring one)
+	// permanent ones get re-inserted; this effectively re-sorts them by time
+	for (emu_timer *timer : timers)
+	{
+		if (timer->m_temporary && !timer->expire().is_never())
+			m_timer_allocator.reclaim(timer);
 		else
-			private_list.append(timer_list_remove(timer));
+			timer_list_insert(*timer);
 	}
 
-	// now re-insert them; this effectively re-sorts them by time
-	emu_timer *timer;
-	while ((timer = private_list.detach_head()) != nullptr)
-		timer_list_insert(*timer);
-
 	m_suspend_changes_pending = true;
 	rebuild_execute_list();
 
@@ -810,63 +835,29 @@ void device_scheduler::rebuild_execute_list()
 
 //-------------------------------------------------
 //  timer_list_insert - insert a new timer into
-//  the list at the appropriate location
+//  the heap at the appropriate location
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 {
-	// disabled timers sort to the end
-	const attotime expire = timer.m_enabled ? timer.m_expire : attotime::never;
-
-	// loop over the timer list
-	emu_timer *prevtimer = nullptr;
-	for (emu_timer *curtimer = m_timer_list; curtimer != nullptr; prevtimer = curtimer, curtimer = curtimer->next())
-	{
-		// if the current list entry expires after us, we should be inserted before it
-		if (curtimer->m_expire > expire)
-		{
-			// link the new guy in before the current list entry
-			timer.m_prev = prevtimer;
-			timer.m_next = curtimer;
-
-			if (prevtimer != nullptr)
-				prevtimer->m_next = &timer;
-			else
-				m_timer_list = &timer;
-
-			curtimer->m_prev = &timer;
-			return timer;
-		}
-	}
+	// disabled timers sort to the end; timers with the same expiry time
+	// fire in the order they were inserted
+	timer.m_heap_expire = timer.m_enabled ? timer.m_expire : attotime::never;
+	timer.m_sequence = m_timer_sequence++;
 
-	// need to insert after the last one
-	if (prevtimer != nullptr)
-		prevtimer->m_next = &timer;
-	else
-		m_timer_list = &timer;
-
-	timer.m_prev = prevtimer;
-	timer.m_next = nullptr;
+	m_timer_heap.insert(timer);
 	return timer;
 }
 
 
 //-------------------------------------------------
 //  timer_list_remove - remove a timer from the
-//  linked list
+//  heap
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
-	// remove it from the list
-	if (timer.m_prev != nullptr)
-		timer.m_prev->m_next = timer.m_next;
-	else
-		m_timer_list = timer.m_next;
-
-	if (timer.m_next != nullptr)
-		timer.m_next->m_prev = timer.m_prev;
-
+	m_timer_heap.remove(timer);
 	return timer;
 }
 
@@ -877,13 +868,13 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 
 inline void device_scheduler::execute_timers()
 {
-	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_list->m_expire.as_string(PRECISION));
+	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), first_timer()->m_expire.as_string(PRECISION));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (first_timer()->m_expire <= m_basetime)
 	{
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = *first_timer();
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
@@ -981,7 +972,53 @@ void device_scheduler::dump_timers() const
 {
 	machine().logerror("=============================================\n");
 	machine().logerror("Timer Dump: Time = %15s\n", time().as_string(PRECISION));
-	for (emu_timer *timer = first_timer(); timer != nullptr; timer = timer->next())
+	std::vector<emu_timer *> timers(m_timer_heap.begin(), m_timer_heap.end());
+	std::sort(timers.begin(), timers.end(), [] (emu_timer const *a, emu_timer const *b) { return timer_precedes(*a, *b); });
+	for (emu_timer const *timer : timers)
 		timer->dump();
 	machine().logerror("=============================================\n");
 }
+
+
+//-------------------------------------------------
+//  stats - return per-device execution statistics
+//-------------------------------------------------
+
+std::vector<device_scheduler::device_stats> device_scheduler::stats() const
+{
+	std::vector<device_stats> result;
+	const double ticks_per_second = double(osd_ticks_per_second());
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+		result.emplace_back(device_stats{ &exec, exec.total_cycles(), exec.m_stat_timeslices, double(exec.m_stat_ticks) / ticks_per_second, exec.m_stat_aborts, exec.m_stat_boosts });
+	return result;
+}
+
+
+//-------------------------------------------------
+//  dump_stats - print per-device execution
+//  statistics
+//-------------------------------------------------
+
+void device_scheduler::dump_stats() const
+{
+	std::vector<device_stats> const devices(stats());
+	double total = 0.0;
+	for (device_stats const &dev : devices)
+		total += dev.seconds;
+
+	osd_printf_info("Device execution statistics:\n");
+	osd_printf_info("%-24s %16s %12s %10s %7s %10s %8s\n", "device", "cycles", "timeslices", "seconds", "share", "aborts", "boosts");
+	for (device_stats const &dev : devices)
+	{
+		osd_printf_info(
+				"%-24s %16d %12d %10.3f %6.1f%% %10d %8d\n",
+				dev.device->device().tag(),
+				dev.cycles,
+				dev.timeslices,
+				dev.seconds,
+				(total > 0.0) ? (dev.seconds * 100.0 / total) : 0.0,
+				dev.aborts,
+				dev.boosts);
+	}
+	osd_printf_info("%d interleave boosts requested in total\n", m_stat_boosts);
+}
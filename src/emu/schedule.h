@@ -52,7 +52,6 @@ class emu_timer
 
 public:
 	// getters
-	emu_timer *next() const { return m_next; }
 	running_machine &machine() const noexcept { assert(m_machine != nullptr); return *m_machine; }
 	bool enabled() const { return m_enabled; }
 	int param() const { return m_param; }
@@ -76,6 +75,7 @@ public:
 
 private:
 	// internal helpers
+	emu_timer *next() const { return m_next; }
 	void register_save();
 	void schedule_next_period();
 	void dump() const;
@@ -83,8 +83,10 @@ private:
 
 	// internal state
 	running_machine *   m_machine;      // reference to the owning machine
-	emu_timer *         m_next;         // next timer in order in the list
-	emu_timer *         m_prev;         // previous timer in order in the list
+	emu_timer *         m_next;         // next timer in the free list
+	u32                 m_heap_index;   // position in the scheduler's timer heap
+	u64                 m_sequence;     // insertion order, to keep timers with equal expiry in order
+	attotime            m_heap_expire;  // expiry time the timer is ordered by in the heap
 	timer_expired_delegate m_callback;  // callback function
 	s32                 m_param;        // integer parameter
 	void *              m_ptr;          // pointer parameter
@@ -113,7 +115,7 @@ public:
 	// getters
 	running_machine &machine() const noexcept { return m_machine; }
 	attotime time() const noexcept;
-	emu_timer *first_timer() const { return m_timer_list; }
+	emu_timer *first_timer() const { return m_timer_heap.front(); }
 	device_execute_interface *currently_executing() const noexcept { return m_executing_device; }
 	bool can_save() const;
 
@@ -133,8 +135,23 @@ public:
 	emu_timer *timer_alloc(device_t &device, device_timer_id id = 0, void *ptr = nullptr);
 	void timer_set(const attotime &duration, device_t &device, device_timer_id id = 0, int param = 0, void *ptr = nullptr);
 
+	// per-device execution statistics, collected with -profile_devices
+	struct device_stats
+	{
+		device_execute_interface *  device;                 // the device
+		u64                         cycles;                 // total cycles executed
+		u64                         timeslices;             // number of times the device was run
+		double                      seconds;                // host time spent in execute_run
+		u64                         aborts;                 // number of aborted timeslices
+		u64                         boosts;                 // interleave boosts requested while running
+	};
+	bool profiling_devices() const { return m_profile_devices; }
+	std::vector<device_stats> stats() const;
+	u64 total_boosts() const { return m_stat_boosts; }
+
 	// debugging
 	void dump_timers() const;
+	void dump_stats() const;
 
 	// for emergencies only!
 	void eat_all_cycles();
@@ -150,10 +167,12 @@ private:
 	void rebuild_execute_list();
 	void apply_suspend_changes();
 	void add_scheduling_quantum(const attotime &quantum, const attotime &duration);
+	attotime execute_devices(attotime target, bool call_debugger);
 
 	// timer helpers
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	static bool timer_precedes(const emu_timer &a, const emu_timer &b) { return (a.m_heap_expire < b.m_heap_expire) || ((a.m_heap_expire == b.m_heap_expire) && (a.m_sequence < b.m_sequence)); }
 	void execute_timers();
 
 	// internal state
@@ -162,8 +181,14 @@ private:
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
-	// list of active timers
-	emu_timer *                 m_timer_list;               // head of the active list
+	// heap of active timers
+	struct timer_heap_traits
+	{
+		static bool precedes(const emu_timer &a, const emu_timer &b) { return timer_precedes(a, b); }
+		static u32 &heap_index(emu_timer &timer) { return timer.m_heap_index; }
+	};
+	timer_heap<emu_timer, timer_heap_traits> m_timer_heap;  // binary min-heap ordered by expiry time
+	u64                         m_timer_sequence;           // next timer insertion sequence number
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
 
 	// other internal states
@@ -188,6 +213,10 @@ private:
 	simple_list<quantum_slot>   m_quantum_list;             // list of active quanta
 	fixed_allocator<quantum_slot> m_quantum_allocator;      // allocator for quanta
 	attoseconds_t               m_quantum_minimum;          // duration of minimum quantum
+
+	// per-device statistics
+	bool                        m_profile_devices;          // collect per-device statistics
+	u64                         m_stat_boosts;              // total interleave boosts requested
 };
 
 
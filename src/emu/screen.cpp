@@ -552,6 +552,7 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_texformat()
 	, m_curbitmap(0)
 	, m_curtexture(0)
+	, m_texture_visarea(0, 99, 0, 99)
 	, m_changed(true)
 	, m_last_partial_scan(0)
 	, m_partial_scan_hpos(-1)
@@ -569,6 +570,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_scanline_timer(nullptr)
 	, m_frame_number(0)
 	, m_partial_updates_this_frame(0)
+	, m_time_updates(false)
+	, m_update_ticks(0)
 {
 	m_unique_id = m_id_counter;
 	m_id_counter++;
@@ -789,6 +792,9 @@ void screen_device::device_start()
 	if (m_palette && !m_palette->device().started())
 		throw device_missing_dependencies();
 
+	// only time the update callbacks when a benchmark report will be written
+	m_time_updates = *machine().options().bench_report() != '\0';
+
 	if (m_type == SCREEN_TYPE_SVG)
 	{
 		if (!m_svg_region)
@@ -822,8 +828,10 @@ void screen_device::device_start()
 	// allocate raw textures
 	m_texture[0] = machine().render().texture_alloc();
 	m_texture[0]->set_id(u64(m_unique_id) << 57);
+	m_texture[0]->set_explicit_update(true);
 	m_texture[1] = machine().render().texture_alloc();
 	m_texture[1]->set_id((u64(m_unique_id) << 57) | 1);
+	m_texture[1]->set_explicit_update(true);
 
 	// configure the default cliparea
 	render_container::user_settings settings = m_container->get_user_settings();
@@ -1120,6 +1128,7 @@ void screen_device::realloc_screen_bitmaps()
 	}
 	m_texture[0]->set_bitmap(m_bitmap[0], m_visarea, m_bitmap[0].texformat());
 	m_texture[1]->set_bitmap(m_bitmap[1], m_visarea, m_bitmap[1].texformat());
+	m_texture_visarea = m_visarea;
 
 	allocate_scan_bitmaps();
 }
@@ -1197,6 +1206,7 @@ bool screen_device::update_partial(int scanline)
 	// otherwise, render
 	LOG_PARTIAL_UPDATES(("updating %d-%d\n", clip.top(), clip.bottom()));
 	g_profiler.start(PROFILER_VIDEO);
+	osd_ticks_t const update_start = UNEXPECTED(m_time_updates) ? osd_ticks() : 0;
 
 	u32 flags = 0;
 	if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
@@ -1237,6 +1247,8 @@ bool screen_device::update_partial(int scanline)
 		m_partial_updates_this_frame++;
 	}
 
+	if (UNEXPECTED(m_time_updates))
+		m_update_ticks += osd_ticks() - update_start;
 	g_profiler.stop();
 
 	// if we modified the bitmap, we have to commit
@@ -1310,6 +1322,7 @@ void screen_device::update_now()
 			if (!clip.empty())
 			{
 				g_profiler.start(PROFILER_VIDEO);
+				osd_ticks_t const update_start = UNEXPECTED(m_time_updates) ? osd_ticks() : 0;
 
 				u32 flags = 0;
 				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
@@ -1333,6 +1346,8 @@ void screen_device::update_now()
 					}
 				}
 
+				if (UNEXPECTED(m_time_updates))
+					m_update_ticks += osd_ticks() - update_start;
 				g_profiler.stop();
 				m_partial_updates_this_frame++;
 
@@ -1361,6 +1376,7 @@ void screen_device::update_now()
 	if (!clip.empty())
 	{
 		g_profiler.start(PROFILER_VIDEO);
+		osd_ticks_t const update_start = UNEXPECTED(m_time_updates) ? osd_ticks() : 0;
 
 		LOG_PARTIAL_UPDATES(("doing scanline partial draw: Y %d X %d-%d\n", clip.bottom(), clip.left(), clip.right()));
 
@@ -1387,6 +1403,8 @@ void screen_device::update_now()
 		}
 
 		m_partial_updates_this_frame++;
+		if (UNEXPECTED(m_time_updates))
+			m_update_ticks += osd_ticks() - update_start;
 		g_profiler.stop();
 
 		// if we modified the bitmap, we have to commit
@@ -1745,6 +1763,37 @@ void screen_device::create_composited_bitmap()
 }
 
 
+//-------------------------------------------------
+//  frame_matches_texture - return true if the
+//  bitmap just drawn shows exactly what the
+//  current texture already holds
+//-------------------------------------------------
+
+bool screen_device::frame_matches_texture()
+{
+	// paletted textures can change without their pixels changing, so only compare RGB
+	if ((m_curbitmap == m_curtexture) || (m_video_attributes & VIDEO_VARIABLE_WIDTH))
+		return false;
+	screen_bitmap &drawn = m_bitmap[m_curbitmap];
+	screen_bitmap &shown = m_bitmap[m_curtexture];
+	if (drawn.format() != BITMAP_FORMAT_RGB32 || shown.format() != BITMAP_FORMAT_RGB32)
+		return false;
+	if (!drawn.cliprect().contains(m_visarea) || !shown.cliprect().contains(m_visarea))
+		return false;
+
+	// the texture shows the visible area it was set up with, so a resized or moved area needs a new one
+	if (m_texture_visarea != m_visarea)
+		return false;
+
+	// compare the visible area row by row, stopping at the first difference
+	size_t const rowbytes = m_visarea.width() * sizeof(u32);
+	for (int y = m_visarea.top(); y <= m_visarea.bottom(); y++)
+		if (memcmp(&drawn.as_rgb32().pix(y, m_visarea.left()), &shown.as_rgb32().pix(y, m_visarea.left()), rowbytes) != 0)
+			return false;
+	return true;
+}
+
+
 //-------------------------------------------------
 //  update_quads - set up the quads for this
 //  screen
@@ -1758,8 +1807,9 @@ bool screen_device::update_quads()
 		// only update if empty and not a vector game; otherwise assume the driver did it directly
 		if (m_type != SCREEN_TYPE_VECTOR && (m_video_attributes & VIDEO_SELF_RENDER) == 0)
 		{
-			// if we're not skipping the frame and if the screen actually changed, then update the texture
-			if (!machine().video().skip_this_frame() && m_changed)
+			// if we're not skipping the frame and if the screen actually changed, then update the texture;
+			// a frame identical to the one already shown keeps its texture so it isn't uploaded again
+			if (!machine().video().skip_this_frame() && m_changed && !frame_matches_texture())
 			{
 				if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 				{
@@ -1767,6 +1817,7 @@ bool screen_device::update_quads()
 				}
 				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
 				m_curtexture = m_curbitmap;
+				m_texture_visarea = m_visarea;
 				m_curbitmap = 1 - m_curbitmap;
 			}
 
@@ -408,6 +408,7 @@ public:
 
 	// updating
 	int partial_updates() const { return m_partial_updates_this_frame; }
+	osd_ticks_t update_ticks() const { return m_update_ticks; }
 	int partial_scan_hpos() const { return m_partial_scan_hpos; }
 	bool update_partial(int scanline);
 	void update_now();
@@ -457,6 +458,7 @@ private:
 	void update_scan_bitmap_size(int y);
 	void pre_update_scanline(int y);
 	void create_composited_bitmap();
+	bool frame_matches_texture();
 	void destroy_scan_bitmaps();
 	void allocate_scan_bitmaps();
 
@@ -496,6 +498,7 @@ private:
 	bitmap_ind64        m_burnin;                   // burn-in bitmap
 	u8                  m_curbitmap;                // current bitmap index
 	u8                  m_curtexture;               // current texture index
+	rectangle           m_texture_visarea;          // visible area the current texture was set up with
 	bool                m_changed;                  // has this bitmap changed?
 	s32                 m_last_partial_scan;        // scanline of last partial update
 	s32                 m_partial_scan_hpos;        // horizontal pixel last rendered on this partial scanline
@@ -517,6 +520,8 @@ private:
 	emu_timer *         m_scanline_timer;           // scanline timer
 	u64                 m_frame_number;             // the current frame number
 	u32                 m_partial_updates_this_frame;// partial update counter this frame
+	bool                m_time_updates;             // collect update timing for the benchmark report
+	osd_ticks_t         m_update_ticks;             // total host time spent in screen update callbacks
 
 	bool                m_is_primary_screen;
 
@@ -39,7 +39,6 @@
 //  GLOBAL VARIABLES
 //**************************************************************************
 
-const attotime sound_manager::STREAMS_UPDATE_ATTOTIME = attotime::from_hz(STREAMS_UPDATE_FREQUENCY);
 
 
 
@@ -565,7 +564,10 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 	m_empty_buffer(100),
 	m_output_base(output_base),
 	m_output(outputs),
-	m_output_view(outputs)
+	m_output_view(outputs),
+	m_time_updates((*device.machine().options().bench_report() != '\0') || device.machine().options().profile_devices()),
+	m_update_ticks(0),
+	m_update_samples(0)
 {
 	sound_assert(outputs > 0);
 
@@ -739,7 +741,11 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 #endif
 
 			// if we have an extended callback, that's all we need
+			osd_ticks_t const callback_start = UNEXPECTED(m_time_updates) ? osd_ticks() : 0;
 			m_callback_ex(*this, m_input_view, m_output_view);
+			if (UNEXPECTED(m_time_updates))
+				m_update_ticks += osd_ticks() - callback_start;
+			m_update_samples += samples;
 
 #if (SOUND_DEBUG)
 			// make sure everything was overwritten
@@ -1028,10 +1034,12 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 
 			// add in complete samples until we only have a fraction left
 			stream_buffer::sample_t remaining = step - scale;
-			while (remaining >= 1.0)
+			if (remaining >= 1.0)
 			{
-				sample += rebased.get(srcindex++);
-				remaining -= 1.0;
+				s32 whole = s32(remaining);
+				sample = rebased.sum(srcindex, whole, sample);
+				srcindex += whole;
+				remaining -= stream_buffer::sample_t(whole);
 			}
 
 			// add in the final partial sample
@@ -1059,8 +1067,11 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 sound_manager::sound_manager(running_machine &machine) :
 	m_machine(machine),
 	m_update_timer(nullptr),
+	m_update_rate(STREAMS_UPDATE_FREQUENCY),
 	m_update_number(0),
 	m_last_update(attotime::zero),
+	m_time_updates(*machine.options().bench_report() != '\0'),
+	m_update_ticks(0),
 	m_finalmix_leftover(0),
 	m_samples_this_update(0),
 	m_finalmix(machine.sample_rate()),
@@ -1104,7 +1115,9 @@ sound_manager::sound_manager(running_machine &machine) :
 
 	// start the periodic update flushing timer
 	m_update_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(sound_manager::update), this));
-	m_update_timer->adjust(STREAMS_UPDATE_ATTOTIME, 0, STREAMS_UPDATE_ATTOTIME);
+	m_update_rate = std::clamp(machine.options().sound_update_rate(), STREAMS_UPDATE_FREQUENCY, 1000);
+	attotime const update_period = attotime::from_hz(m_update_rate);
+	m_update_timer->adjust(update_period, 0, update_period);
 }
 
 
@@ -1460,6 +1473,7 @@ void sound_manager::update(void *ptr, int param)
 	VPRINTF(("sound_update\n"));
 
 	g_profiler.start(PROFILER_SOUND);
+	osd_ticks_t const update_start = UNEXPECTED(m_time_updates) ? osd_ticks() : 0;
 
 	// determine the duration of this update
 	attotime update_period = machine().time() - m_last_update;
@@ -1505,7 +1519,7 @@ void sound_manager::update(void *ptr, int param)
 	if (curmax * m_compressor_scale > 1.0)
 	{
 		m_compressor_scale = 1.0 / curmax;
-		m_compressor_counter = STREAMS_UPDATE_FREQUENCY / 5;
+		m_compressor_counter = m_update_rate / 5;
 	}
 
 	// if we're currently scaled, wait a bit to see if we can trend back toward 1.0
@@ -1590,5 +1604,7 @@ void sound_manager::update(void *ptr, int param)
 	// notify that new samples have been generated
 	emulator_info::sound_hook();
 
+	if (UNEXPECTED(m_time_updates))
+		m_update_ticks += osd_ticks() - update_start;
 	g_profiler.stop();
 }
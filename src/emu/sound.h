@@ -328,7 +328,60 @@ public:
 		return m_buffer->get(index);
 	}
 
+	// add a run of gain-scaled samples to a running total one at a time, in the
+	// same order and with the same rounding as adding get() for each sample
+	sample_t sum(s32 start, s32 count, sample_t total = 0) const
+	{
+		sample_t const gain = m_gain;
+		for_each_span(start, count, [&total, gain] (sample_t *src, s32, s32 chunk)
+		{
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				total += src[sampindex] * gain;
+		});
+		return total;
+	}
+
+	// copy a run of gain-scaled samples into a flat array
+	void copy_to(sample_t *dest, s32 start, s32 count) const
+	{
+		sample_t const gain = m_gain;
+		for_each_span(start, count, [dest, gain] (sample_t *src, s32 offset, s32 chunk)
+		{
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				dest[offset + sampindex] = src[sampindex] * gain;
+		});
+	}
+
+	// accumulate a run of gain-scaled samples into a flat array
+	void add_to(sample_t *dest, s32 start, s32 count) const
+	{
+		sample_t const gain = m_gain;
+		for_each_span(start, count, [dest, gain] (sample_t *src, s32 offset, s32 chunk)
+		{
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				dest[offset + sampindex] += src[sampindex] * gain;
+		});
+	}
+
 protected:
+	// invoke func(ptr, offset, count) over the underlying buffer for the
+	// given range, split into at most two contiguous pieces at the wrap
+	template<typename Func>
+	void for_each_span(s32 start, s32 count, Func &&func) const
+	{
+		sound_assert(start >= 0 && count >= 0 && u32(start + count) <= samples());
+		u32 index = m_buffer->clamp_index(start + m_start);
+		s32 offset = 0;
+		while (count > 0)
+		{
+			s32 chunk = std::min<s32>(count, m_buffer->size() - index);
+			func(&m_buffer->m_buffer[index], offset, chunk);
+			offset += chunk;
+			count -= chunk;
+			index = 0;
+		}
+	}
+
 	// normalize start/end
 	void normalize_start_end()
 	{
@@ -421,12 +474,10 @@ public:
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = start + m_start;
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		for_each_span(start, count, [value] (sample_t *dest, s32, s32 chunk)
 		{
-			m_buffer->put(index, value);
-			index = m_buffer->next_index(index);
-		}
+			std::fill_n(dest, chunk, value);
+		});
 	}
 	void fill(sample_t value, s32 start) { fill(value, start, samples() - start); }
 	void fill(sample_t value) { fill(value, 0, samples()); }
@@ -436,12 +487,10 @@ public:
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = start + m_start;
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		for_each_span(start, count, [&src, start] (sample_t *dest, s32 offset, s32 chunk)
 		{
-			m_buffer->put(index, src.get(start + sampindex));
-			index = m_buffer->next_index(index);
-		}
+			src.copy_to(dest, start + offset, chunk);
+		});
 	}
 	void copy(read_stream_view const &src, s32 start) { copy(src, start, samples() - start); }
 	void copy(read_stream_view const &src) { copy(src, 0, samples()); }
@@ -451,12 +500,10 @@ public:
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = start + m_start;
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		for_each_span(start, count, [&src, start] (sample_t *dest, s32 offset, s32 chunk)
 		{
-			m_buffer->put(index, m_buffer->get(index) + src.get(start + sampindex));
-			index = m_buffer->next_index(index);
-		}
+			src.add_to(dest, start + offset, chunk);
+		});
 	}
 	void add(read_stream_view const &src, s32 start) { add(src, start, samples() - start); }
 	void add(read_stream_view const &src) { add(src, 0, samples()); }
@@ -631,6 +678,12 @@ public:
 	attotime sample_period() const { return attotime(0, sample_period_attoseconds()); }
 	attoseconds_t sample_period_attoseconds() const { return (m_sample_rate != SAMPLE_RATE_INVALID) ? HZ_TO_ATTOSECONDS(m_sample_rate) : ATTOSECONDS_PER_SECOND; }
 
+	// profiling getters; times cover only this stream's own callback, not its inputs,
+	// and are only collected with a benchmark report or device profiling enabled
+	osd_ticks_t update_ticks() const { return m_update_ticks; }
+	u64 update_samples() const { return m_update_samples; }
+	std::vector<std::unique_ptr<sound_stream>> const &resamplers() const { return m_resampler_list; }
+
 	// set the sample rate of the stream; will kick in at the next global update
 	void set_sample_rate(u32 sample_rate);
 
@@ -701,6 +754,11 @@ private:
 
 	// callback information
 	stream_update_delegate m_callback_ex;          // extended callback function
+
+	// profiling
+	bool m_time_updates;                           // collect callback timing for reports
+	osd_ticks_t m_update_ticks;                    // total host time spent in the callback
+	u64 m_update_samples;                          // total samples generated by the callback
 };
 
 
@@ -741,10 +799,9 @@ class sound_manager
 	static constexpr u8 MUTE_REASON_DEBUGGER = 0x04;
 	static constexpr u8 MUTE_REASON_SYSTEM = 0x08;
 
-	// stream updates
-	static const attotime STREAMS_UPDATE_ATTOTIME;
-
 public:
+	// minimum (and default) rate of the periodic update; streams size their
+	// buffers assuming no update covers more than this period
 	static constexpr int STREAMS_UPDATE_FREQUENCY = 50;
 
 	// construction/destruction
@@ -757,6 +814,7 @@ public:
 	const std::vector<std::unique_ptr<sound_stream>> &streams() const { return m_stream_list; }
 	attotime last_update() const { return m_last_update; }
 	int sample_count() const { return m_samples_this_update; }
+	osd_ticks_t update_ticks() const { return m_update_ticks; }
 	int unique_id() { return m_unique_id++; }
 
 	// allocate a new stream with a new-style callback
@@ -810,16 +868,19 @@ private:
 	// helper to adjust scale factor toward a goal
 	stream_buffer::sample_t adjust_toward_compressor_scale(stream_buffer::sample_t curscale, stream_buffer::sample_t prevsample, stream_buffer::sample_t rawsample);
 
-	// periodic sound update, called STREAMS_UPDATE_FREQUENCY per second
+	// periodic sound update, called m_update_rate times per second
 	void update(void *ptr = nullptr, s32 param = 0);
 
 	// internal state
 	running_machine &m_machine;           // reference to the running machine
 	emu_timer *m_update_timer;            // timer that runs the update function
+	int m_update_rate;                    // periodic updates per emulated second
 	std::vector<std::reference_wrapper<speaker_device> > m_speakers;
 
 	u32 m_update_number;                  // current update index; used for sample rate updates
 	attotime m_last_update;               // time of the last update
+	bool m_time_updates;                  // collect update timing for the benchmark report
+	osd_ticks_t m_update_ticks;           // total host time spent in periodic updates
 	u32 m_finalmix_leftover;              // leftover samples in the final mix
 	u32 m_samples_this_update;            // number of samples this update
 	std::vector<s16> m_finalmix;          // final mix, in 16-bit signed format
@@ -11,8 +11,123 @@
 #include "emu.h"
 #include "tilemap.h"
 
+#include "emuopts.h"
 #include "screen.h"
 
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define TILEMAP_SSE2 1
+#include <emmintrin.h>
+#else
+#define TILEMAP_SSE2 0
+#endif
+
+
+//**************************************************************************
+//  SCANLINE HELPERS
+//**************************************************************************
+
+namespace {
+
+//-------------------------------------------------
+//  update_priority - apply the priority code to
+//  every pixel of a scanline
+//-------------------------------------------------
+
+inline void update_priority(u8 *pri, int count, u32 pcode)
+{
+	int i = 0;
+#if TILEMAP_SSE2
+	__m128i const andmask = _mm_set1_epi8(s8(pcode >> 8));
+	__m128i const ormask = _mm_set1_epi8(s8(pcode));
+	for ( ; (i + 16) <= count; i += 16)
+	{
+		__m128i const p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pri[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&pri[i]), _mm_or_si128(_mm_and_si128(p, andmask), ormask));
+	}
+#endif
+	for ( ; i < count; i++)
+		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+
+//-------------------------------------------------
+//  update_priority_masked - apply the priority
+//  code to pixels whose flags match the mask
+//-------------------------------------------------
+
+inline void update_priority_masked(const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
+{
+	int i = 0;
+#if TILEMAP_SSE2
+	__m128i const andmask = _mm_set1_epi8(s8(pcode >> 8));
+	__m128i const ormask = _mm_set1_epi8(s8(pcode));
+	__m128i const flagmask = _mm_set1_epi8(s8(mask));
+	__m128i const flagvalue = _mm_set1_epi8(s8(value));
+	for ( ; (i + 16) <= count; i += 16)
+	{
+		__m128i const m = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&maskptr[i]));
+		__m128i const select = _mm_cmpeq_epi8(_mm_and_si128(m, flagmask), flagvalue);
+		__m128i const p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pri[i]));
+		__m128i const updated = _mm_or_si128(_mm_and_si128(p, andmask), ormask);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&pri[i]), _mm_or_si128(_mm_and_si128(select, updated), _mm_andnot_si128(select, p)));
+	}
+#endif
+	for ( ; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+
+//-------------------------------------------------
+//  copy_offset_ind16 - copy indexed pixels,
+//  adding a palette offset
+//-------------------------------------------------
+
+inline void copy_offset_ind16(u16 *dest, const u16 *source, int count, int pal)
+{
+	int i = 0;
+#if TILEMAP_SSE2
+	__m128i const offset = _mm_set1_epi16(s16(pal));
+	for ( ; (i + 8) <= count; i += 8)
+	{
+		__m128i const s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_add_epi16(s, offset));
+	}
+#endif
+	for ( ; i < count; i++)
+		dest[i] = source[i] + pal;
+}
+
+
+//-------------------------------------------------
+//  copy_masked_ind16 - copy indexed pixels whose
+//  flags match the mask, adding a palette offset
+//-------------------------------------------------
+
+inline void copy_masked_ind16(u16 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, int pal)
+{
+	int i = 0;
+#if TILEMAP_SSE2
+	__m128i const offset = _mm_set1_epi16(s16(pal));
+	__m128i const flagmask = _mm_set1_epi8(s8(mask));
+	__m128i const flagvalue = _mm_set1_epi8(s8(value));
+	for ( ; (i + 8) <= count; i += 8)
+	{
+		__m128i const m = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&maskptr[i]));
+		__m128i select = _mm_cmpeq_epi8(_mm_and_si128(m, flagmask), flagvalue);
+		select = _mm_unpacklo_epi8(select, select);
+		__m128i const s = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i])), offset);
+		__m128i const d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dest[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_or_si128(_mm_and_si128(select, s), _mm_andnot_si128(select, d)));
+	}
+#endif
+	for ( ; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			dest[i] = source[i] + pal;
+}
+
+} // anonymous namespace
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -114,8 +229,7 @@ inline void tilemap_t::scanline_draw_opaque_null(int count, u8 *pri, u32 pcode)
 		return;
 
 	// update priority across the scanline
-	for (int i = 0; i < count; i++)
-		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	update_priority(pri, count, pcode);
 }
 
 
@@ -131,9 +245,7 @@ inline void tilemap_t::scanline_draw_masked_null(const u8 *maskptr, int mask, in
 		return;
 
 	// update priority across the scanline, checking the mask
-	for (int i = 0; i < count; i++)
-		if ((maskptr[i] & mask) == value)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	update_priority_masked(maskptr, mask, value, count, pri, pcode);
 }
 
 
@@ -157,25 +269,20 @@ inline void tilemap_t::scanline_draw_opaque_ind16(u16 *dest, const u16 *source,
 			return;
 
 		// update priority across the scanline
-		for (int i = 0; i < count; i++)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+		update_priority(pri, count, pcode);
 	}
 
 	// priority case
 	else if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = source[i] + pal;
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		copy_offset_ind16(dest, source, count, pal);
+		update_priority(pri, count, pcode);
 	}
 
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
-			dest[i] = source[i] + pal;
+		copy_offset_ind16(dest, source, count, pal);
 	}
 }
 
@@ -189,24 +296,10 @@ inline void tilemap_t::scanline_draw_masked_ind16(u16 *dest, const u16 *source,
 {
 	int pal = pcode >> 16;
 
-	// priority case
+	// copy the pixels, then update priority if needed
+	copy_masked_ind16(dest, source, maskptr, mask, value, count, pal);
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = source[i] + pal;
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = source[i] + pal;
-	}
+		update_priority_masked(maskptr, mask, value, count, pri, pcode);
 }
 
 
@@ -220,22 +313,11 @@ inline void tilemap_t::scanline_draw_opaque_rgb32(u32 *dest, const u16 *source,
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
-	// priority case
+	// the palette lookup doesn't vectorize, but the priority update does
+	for (int i = 0; i < count; i++)
+		dest[i] = clut[source[i]];
 	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = clut[source[i]];
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
-
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = clut[source[i]];
-	}
+		update_priority(pri, count, pcode);
 }
 
 
@@ -1007,6 +1089,34 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
+	// split into bands if we can; every tile must be clean before other threads see it
+	if (m_manager->draw_bands(blit.cliprect) > 1)
+	{
+		pixmap_update();
+		m_manager->draw_in_bands(blit.cliprect, [this, &screen, &dest, &blit] (const rectangle &band)
+				{
+					blit_parameters bandblit = blit;
+					bandblit.cliprect = band;
+					draw_clipped(screen, dest, bandblit);
+				});
+	}
+	else
+	{
+		draw_clipped(screen, dest, blit);
+	}
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  draw_clipped - draw a tilemap within the
+//  blit cliprect; the pixmap may be updated
+//  lazily only when called from the main thread
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_clipped(screen_device &screen, _BitmapClass &dest, blit_parameters blit)
+{
 	// flip the tilemap around the center of the visible area
 	rectangle const visarea = screen.visible_area();
 	u32 const xextent = visarea.right() + visarea.left() + 1; // x0 + x1 + 1 for calculating horizontal centre as (x0 + x1 + 1) >> 1
@@ -1095,7 +1205,6 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 			}
 		}
 	}
-g_profiler.stop();
 }
 
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask)
@@ -1144,8 +1253,20 @@ g_profiler.start(PROFILER_TILEMAP_DRAW_ROZ);
 	// get the full pixmap for the tilemap
 	pixmap();
 
-	// then do the roz copy
-	draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+	// then do the roz copy, in bands if we can
+	if (m_manager->draw_bands(blit.cliprect) > 1)
+	{
+		m_manager->draw_in_bands(blit.cliprect, [this, &screen, &dest, &blit, startx, starty, incxx, incxy, incyx, incyy, wraparound] (const rectangle &band)
+				{
+					blit_parameters bandblit = blit;
+					bandblit.cliprect = band;
+					draw_roz_core(screen, dest, bandblit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+				});
+	}
+	else
+	{
+		draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+	}
 g_profiler.stop();
 }
 
@@ -1576,8 +1697,11 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_draw_queue(nullptr)
 {
+	if (machine.options().parallel_tilemaps())
+		m_draw_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 }
 
 
@@ -1600,6 +1724,60 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	if (m_draw_queue)
+		osd_work_queue_free(m_draw_queue);
+}
+
+
+//-------------------------------------------------
+//  draw_bands - return how many bands a draw to
+//  the given cliprect would be split into
+//-------------------------------------------------
+
+int tilemap_manager::draw_bands(const rectangle &cliprect) const
+{
+	if (!m_draw_queue)
+		return 1;
+	return std::max(std::min(DRAW_BANDS, cliprect.height() / DRAW_BAND_MIN_HEIGHT), 1);
+}
+
+
+//-------------------------------------------------
+//  draw_in_bands - split a draw into horizontal
+//  bands and render them on the work queue
+//-------------------------------------------------
+
+void tilemap_manager::draw_in_bands(const rectangle &cliprect, const std::function<void (const rectangle &)> &draw)
+{
+	int const bands = draw_bands(cliprect);
+	assert(bands > 1);
+
+	// each band gets an even share of the rows, with the remainder in the last
+	draw_band band[DRAW_BANDS];
+	int const bandheight = cliprect.height() / bands;
+	for (int index = 0; index < bands; index++)
+	{
+		band[index].draw = &draw;
+		band[index].cliprect = cliprect;
+		band[index].cliprect.sety(cliprect.top() + index * bandheight, (index == (bands - 1)) ? cliprect.bottom() : (cliprect.top() + (index + 1) * bandheight - 1));
+	}
+
+	osd_work_item_queue_multiple(m_draw_queue, &tilemap_manager::draw_band_callback, bands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	while (!osd_work_queue_wait(m_draw_queue, osd_ticks_per_second() * 10)) { }
+}
+
+
+//-------------------------------------------------
+//  draw_band_callback - render one band on a
+//  work queue thread
+//-------------------------------------------------
+
+void *tilemap_manager::draw_band_callback(void *param, int threadid)
+{
+	draw_band const &band = *reinterpret_cast<draw_band const *>(param);
+	(*band.draw)(band.cliprect);
+	return nullptr;
 }
 
 
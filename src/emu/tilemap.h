@@ -555,6 +555,7 @@ private:
 	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
+	template<class _BitmapClass> void draw_clipped(screen_device &screen, _BitmapClass &dest, blit_parameters blit);
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
@@ -643,7 +644,24 @@ public:
 	void mark_all_dirty();
 	void set_flip_all(u32 attributes);
 
+	// parallel drawing
+	int draw_bands(const rectangle &cliprect) const;
+	void draw_in_bands(const rectangle &cliprect, const std::function<void (const rectangle &)> &draw);
+
 private:
+	// a horizontal slice of a parallel draw
+	struct draw_band
+	{
+		const std::function<void (const rectangle &)> *draw;
+		rectangle cliprect;
+	};
+
+	static void *draw_band_callback(void *param, int threadid);
+
+	// bands per parallel draw, and the smallest band worth a thread
+	static constexpr int DRAW_BANDS = 4;
+	static constexpr int DRAW_BAND_MIN_HEIGHT = 32;
+
 	// tilemap creation
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_mapper_delegate mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_standard_mapper mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
@@ -655,6 +673,7 @@ private:
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_draw_queue;
 };
 
 
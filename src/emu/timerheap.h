@@ -0,0 +1,128 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    timerheap.h
+
+    Binary min-heap of pointers to objects that track their own position,
+    used by the scheduler to order active timers.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef MAME_EMU_TIMERHEAP_H
+#define MAME_EMU_TIMERHEAP_H
+
+#include "emucore.h"
+
+#include <cassert>
+#include <vector>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> timer_heap
+
+// Traits supplies the ordering and the stored position of each entry:
+//   static bool precedes(const T &a, const T &b);
+//   static u32 &heap_index(T &entry);
+template <typename T, typename Traits>
+class timer_heap
+{
+public:
+	typedef typename std::vector<T *>::const_iterator const_iterator;
+
+	// getters
+	bool empty() const { return m_heap.empty(); }
+	u32 size() const { return m_heap.size(); }
+	T *front() const { return m_heap.front(); }
+	T *back() const { return m_heap.back(); }
+	const_iterator begin() const { return m_heap.begin(); }
+	const_iterator end() const { return m_heap.end(); }
+
+	// take every entry out of the heap, in no particular order
+	std::vector<T *> release()
+	{
+		std::vector<T *> result;
+		result.swap(m_heap);
+		return result;
+	}
+
+	// add an entry at the bottom of the heap and let it rise to its place
+	void insert(T &entry)
+	{
+		Traits::heap_index(entry) = m_heap.size();
+		m_heap.emplace_back(&entry);
+		sift_up(Traits::heap_index(entry));
+	}
+
+	// remove an entry, replacing it with the last one in the heap
+	void remove(T &entry)
+	{
+		const u32 index = Traits::heap_index(entry);
+		assert(index < m_heap.size() && m_heap[index] == &entry);
+		T *const last = m_heap.back();
+		m_heap.pop_back();
+		if (last != &entry)
+		{
+			// the replacement may need to move either way
+			m_heap[index] = last;
+			Traits::heap_index(*last) = index;
+			if ((index > 0) && Traits::precedes(*last, *m_heap[(index - 1) / 2]))
+				sift_up(index);
+			else
+				sift_down(index);
+		}
+	}
+
+private:
+	// move an entry towards the top of the heap until its parent precedes it
+	void sift_up(u32 index)
+	{
+		T *const entry = m_heap[index];
+		while (index > 0)
+		{
+			const u32 parent = (index - 1) / 2;
+			if (!Traits::precedes(*entry, *m_heap[parent]))
+				break;
+			m_heap[index] = m_heap[parent];
+			Traits::heap_index(*m_heap[index]) = index;
+			index = parent;
+		}
+		m_heap[index] = entry;
+		Traits::heap_index(*entry) = index;
+	}
+
+	// move an entry towards the bottom of the heap until it precedes its children
+	void sift_down(u32 index)
+	{
+		T *const entry = m_heap[index];
+		const u32 count = m_heap.size();
+		while (true)
+		{
+			// find the child that comes first
+			u32 child = (index * 2) + 1;
+			if (child >= count)
+				break;
+			if (((child + 1) < count) && Traits::precedes(*m_heap[child + 1], *m_heap[child]))
+				child++;
+
+			// stop if we come before it
+			if (!Traits::precedes(*m_heap[child], *entry))
+				break;
+			m_heap[index] = m_heap[child];
+			Traits::heap_index(*m_heap[index]) = index;
+			index = child;
+		}
+		m_heap[index] = entry;
+		Traits::heap_index(*entry) = index;
+	}
+
+	std::vector<T *> m_heap;
+};
+
+
+#endif // MAME_EMU_TIMERHEAP_H
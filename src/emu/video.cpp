@@ -22,6 +22,9 @@
 
 #include "osdepend.h"
 
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -81,6 +84,7 @@ video_manager::video_manager(running_machine &machine)
 	, m_speed_last_realtime(0)
 	, m_speed_last_emutime(attotime::zero)
 	, m_speed_percent(1.0)
+	, m_frame_count(0)
 	, m_overall_real_seconds(0)
 	, m_overall_real_ticks(0)
 	, m_overall_emutime(attotime::zero)
@@ -99,10 +103,15 @@ video_manager::video_manager(running_machine &machine)
 	, m_frameskip_adjust(0)
 	, m_skipping_this_frame(false)
 	, m_average_oversleep(0)
+	, m_sleep_jitter(osd_ticks_per_second() * machine.options().sleep_jitter() / 1000000)
+	, m_bench_report(machine.options().bench_report())
+	, m_bench_last_ticks(0)
+	, m_bench_last_emutime(attotime::zero)
 	, m_snap_target(nullptr)
 	, m_snap_native(true)
 	, m_snap_width(0)
 	, m_snap_height(0)
+	, m_render_queue(nullptr)
 	, m_timecode_enabled(false)
 	, m_timecode_write(false)
 	, m_timecode_text("")
@@ -116,6 +125,10 @@ video_manager::video_manager(running_machine &machine)
 	// extract initial execution state from global configuration settings
 	update_refresh_speed();
 
+	// software rendering can be spread over multiple threads
+	if (machine.options().parallel_render())
+		m_render_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 	const unsigned screen_count(screen_device_enumerator(machine.root_device()).count());
 	const bool no_screens(!screen_count);
 
@@ -252,6 +265,7 @@ void video_manager::frame_update(bool from_debugger)
 	{
 		// perform tasks for this frame
 		machine().call_notifiers(MACHINE_NOTIFY_FRAME);
+		m_frame_count.store(m_frame_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 
 		// update frameskipping
 		if (phase > machine_phase::INIT)
@@ -260,6 +274,10 @@ void video_manager::frame_update(bool from_debugger)
 		// update speed computations
 		if (!skipped_it && phase > machine_phase::INIT)
 			recompute_speed(current_time);
+
+		// record timing for the benchmark report
+		if (!m_bench_report.empty() && phase == machine_phase::RUNNING)
+			record_bench_frame(current_time);
 	}
 
 	// call the end-of-frame callback
@@ -303,7 +321,7 @@ std::string video_manager::speed_text()
 
 	// append the speed for all cases except paused
 	if (!paused)
-		util::stream_format(str, "%4d%%", (int)(100 * m_speed_percent + 0.5));
+		util::stream_format(str, "%4d%%", (int)(100 * speed_percent() + 0.5));
 
 	// display the number of partial updates as well
 	int partials = 0;
@@ -515,10 +533,21 @@ void video_manager::exit()
 	// stop recording any movie
 	m_movie_recordings.clear();
 
+	// write the benchmark report
+	if (!m_bench_report.empty())
+		write_bench_report();
+
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
 
+	// release the software rendering threads
+	if (m_render_queue)
+	{
+		osd_work_queue_free(m_render_queue);
+		m_render_queue = nullptr;
+	}
+
 	// print a final result if we have at least 2 seconds' worth of data
 	if (!emulator_info::standalone() && m_overall_emutime.seconds() >= 1)
 	{
@@ -530,6 +559,140 @@ void video_manager::exit()
 }
 
 
+//-------------------------------------------------
+//  record_bench_frame - note the emulated and
+//  real time taken by a frame
+//-------------------------------------------------
+
+void video_manager::record_bench_frame(const attotime &emutime)
+{
+	osd_ticks_t const ticks = osd_ticks();
+	if (m_bench_last_ticks != 0)
+		m_bench_frames.emplace_back(bench_frame{ (emutime - m_bench_last_emutime).as_attoseconds(), ticks - m_bench_last_ticks });
+	m_bench_last_ticks = ticks;
+	m_bench_last_emutime = emutime;
+}
+
+
+//-------------------------------------------------
+//  write_bench_report - write per-frame timing,
+//  frame time percentiles and update costs as
+//  JSON
+//-------------------------------------------------
+
+void video_manager::write_bench_report()
+{
+	double const tps = double(osd_ticks_per_second());
+	auto const to_ms = [tps] (osd_ticks_t ticks) { return double(ticks) * 1000.0 / tps; };
+
+	// accumulate totals and sort frame times for percentiles
+	std::vector<osd_ticks_t> sorted;
+	sorted.reserve(m_bench_frames.size());
+	attoseconds_t total_emu = 0;
+	osd_ticks_t total_real = 0;
+	for (bench_frame const &frame : m_bench_frames)
+	{
+		sorted.emplace_back(frame.realtime);
+		total_emu += frame.emutime;
+		total_real += frame.realtime;
+	}
+	std::sort(sorted.begin(), sorted.end());
+	auto const percentile = [&sorted, &to_ms] (unsigned pct) { return sorted.empty() ? 0.0 : to_ms(sorted[((sorted.size() - 1) * pct) / 100]); };
+
+	rapidjson::StringBuffer s;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+	writer.Key("system");
+	writer.String(machine().system().name);
+	writer.Key("frames");
+	writer.Uint64(m_bench_frames.size());
+	writer.Key("emulated_seconds");
+	writer.Double(ATTOSECONDS_TO_DOUBLE(total_emu));
+	writer.Key("real_seconds");
+	writer.Double(double(total_real) / tps);
+	writer.Key("speed_percent");
+	writer.Double(total_real ? (100.0 * ATTOSECONDS_TO_DOUBLE(total_emu) * tps / double(total_real)) : 0.0);
+
+	writer.Key("frame_ms");
+	writer.StartObject();
+	writer.Key("p50");
+	writer.Double(percentile(50));
+	writer.Key("p95");
+	writer.Double(percentile(95));
+	writer.Key("p99");
+	writer.Double(percentile(99));
+	writer.Key("max");
+	writer.Double(sorted.empty() ? 0.0 : to_ms(sorted.back()));
+	writer.EndObject();
+
+	writer.Key("screens");
+	writer.StartObject();
+	for (screen_device &screen : screen_device_enumerator(machine().root_device()))
+	{
+		writer.Key(screen.tag());
+		writer.StartObject();
+		writer.Key("update_ms");
+		writer.Double(to_ms(screen.update_ticks()));
+		writer.Key("update_ms_per_frame");
+		writer.Double(m_bench_frames.empty() ? 0.0 : (to_ms(screen.update_ticks()) / m_bench_frames.size()));
+		writer.EndObject();
+	}
+	writer.EndObject();
+
+	writer.Key("sound");
+	writer.StartObject();
+	writer.Key("update_ms");
+	writer.Double(to_ms(machine().sound().update_ticks()));
+	writer.Key("update_ms_per_frame");
+	writer.Double(m_bench_frames.empty() ? 0.0 : (to_ms(machine().sound().update_ticks()) / m_bench_frames.size()));
+	writer.Key("streams");
+	writer.StartArray();
+	auto const write_stream = [&writer, &to_ms] (sound_stream const &stream)
+	{
+		writer.StartObject();
+		writer.Key("name");
+		writer.String(stream.name().c_str());
+		writer.Key("samples");
+		writer.Uint64(stream.update_samples());
+		writer.Key("update_ms");
+		writer.Double(to_ms(stream.update_ticks()));
+		writer.EndObject();
+	};
+	for (auto const &stream : machine().sound().streams())
+	{
+		write_stream(*stream);
+		for (auto const &resampler : stream->resamplers())
+			write_stream(*resampler);
+	}
+	writer.EndArray();
+	writer.EndObject();
+
+	// per-frame emulated and real times
+	writer.Key("per_frame");
+	writer.StartArray();
+	for (bench_frame const &frame : m_bench_frames)
+	{
+		writer.StartArray();
+		writer.Double(ATTOSECONDS_TO_DOUBLE(frame.emutime) * 1000.0);
+		writer.Double(to_ms(frame.realtime));
+		writer.EndArray();
+	}
+	writer.EndArray();
+	writer.EndObject();
+
+	util::core_file::ptr file;
+	if (util::core_file::open(m_bench_report, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, file) == osd_file::error::NONE)
+	{
+		file->puts(s.GetString());
+		file->puts("\n");
+	}
+	else
+	{
+		osd_printf_error("Error opening benchmark report file %s for writing\n", m_bench_report);
+	}
+}
+
+
 //-------------------------------------------------
 //  screenless_update_callback - update generator
 //  when there are no screens to drive it
@@ -826,8 +989,12 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 	osd_ticks_t current_ticks = osd_ticks();
 	while (current_ticks < target_ticks)
 	{
-		// compute how much time to sleep for, taking into account the average oversleep
+		// if we're close enough and allowed to be early, stop rather than spin
 		osd_ticks_t delta = target_ticks - current_ticks;
+		if (allowed_to_sleep && delta <= m_sleep_jitter)
+			break;
+
+		// compute how much time to sleep for, taking into account the average oversleep
 		if (delta > m_average_oversleep / 1000)
 			delta -= m_average_oversleep / 1000;
 		else
@@ -875,7 +1042,7 @@ void video_manager::update_frameskip()
 	if (effective_throttle() && effective_autoframeskip() && m_frameskip_counter == 0)
 	{
 		// calibrate the "adjusted speed" based on the target
-		double adjusted_speed_percent = m_speed_percent / double(m_throttle_rate);
+		double adjusted_speed_percent = speed_percent() / double(m_throttle_rate);
 
 		double speed = m_speed * 0.001;
 		if (adjusted_speed_percent >= 0.995 * speed)
@@ -893,7 +1060,7 @@ void video_manager::update_frameskip()
 		{
 			// if we're too slow, attempt to increase the frameskip
 			if (adjusted_speed_percent < 0.80 *  speed) // if below 80% speed, be more aggressive
-				m_frameskip_adjust -= (0.90 * speed - m_speed_percent) / 0.05;
+				m_frameskip_adjust -= (0.90 * speed - speed_percent()) / 0.05;
 			else if (m_frameskip_level < 8) // if we're close, only force it up to frameskip 8
 				m_frameskip_adjust--;
 
@@ -977,7 +1144,7 @@ void video_manager::recompute_speed(const attotime &emutime)
 		osd_ticks_t realtime = osd_ticks();
 		osd_ticks_t delta_realtime = realtime - m_speed_last_realtime;
 		osd_ticks_t tps = osd_ticks_per_second();
-		m_speed_percent = delta_emutime.as_double() * (double)tps / (double)delta_realtime;
+		m_speed_percent.store(delta_emutime.as_double() * (double)tps / (double)delta_realtime, std::memory_order_relaxed);
 
 		// remember the last times
 		m_speed_last_realtime = realtime;
@@ -1049,9 +1216,9 @@ void video_manager::create_snapshot_bitmap(screen_device *screen)
 	render_primitive_list &primlist = m_snap_target->get_primitives();
 	primlist.acquire_lock();
 	if (machine().options().snap_bilinear())
-		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels(), m_render_queue);
 	else
-		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels(), m_render_queue);
 	primlist.release_lock();
 }
 
@@ -19,6 +19,8 @@
 
 #include "recording.h"
 
+#include <atomic>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -51,6 +53,7 @@ public:
 	bool throttled() const { return m_throttled; }
 	float throttle_rate() const { return m_throttle_rate; }
 	bool fastforward() const { return m_fastforward; }
+	osd_work_queue *render_queue() const { return m_render_queue; }
 
 	// setters
 	void set_frameskip(int frameskip);
@@ -70,7 +73,8 @@ public:
 
 	// current speed helpers
 	std::string speed_text();
-	double speed_percent() const { return m_speed_percent; }
+	double speed_percent() const { return m_speed_percent.load(std::memory_order_relaxed); }
+	u64 frame_count() const { return m_frame_count.load(std::memory_order_relaxed); }
 	int effective_frameskip() const;
 
 	// snapshots
@@ -119,6 +123,10 @@ private:
 	void create_snapshot_bitmap(screen_device *screen);
 	void record_frame();
 
+	// benchmark reports
+	void record_bench_frame(const attotime &emutime);
+	void write_bench_report();
+
 	// movies
 	void begin_recording_screen(const std::string &filename, uint32_t index, screen_device *screen, movie_recording::format format);
 
@@ -138,7 +146,8 @@ private:
 	// dynamic speed computation
 	osd_ticks_t         m_speed_last_realtime;      // real time at the last speed calculation
 	attotime            m_speed_last_emutime;       // emulated time at the last speed calculation
-	double              m_speed_percent;            // most recent speed percentage
+	std::atomic<double> m_speed_percent;            // most recent speed percentage (also read by the HTTP server)
+	std::atomic<u64>    m_frame_count;              // frames emulated so far (also read by the HTTP server)
 
 	// overall speed computation
 	u32                 m_overall_real_seconds;     // accumulated real seconds at normal speed
@@ -163,6 +172,7 @@ private:
 	s8                  m_frameskip_adjust;
 	bool                m_skipping_this_frame;      // flag: true if we are skipping the current frame
 	osd_ticks_t         m_average_oversleep;        // average number of ticks the OSD oversleeps
+	osd_ticks_t         m_sleep_jitter;             // ticks we may end a throttle wait early rather than spin
 
 	// snapshot stuff
 	render_target *     m_snap_target;              // screen shapshot target
@@ -171,9 +181,23 @@ private:
 	s32                 m_snap_width;               // width of snapshots (0 == auto)
 	s32                 m_snap_height;              // height of snapshots (0 == auto)
 
+	// software rendering
+	osd_work_queue *    m_render_queue;             // queue for banded software rendering, if enabled
+
 	// movie recordings
 	std::vector<movie_recording::ptr> m_movie_recordings;
 
+	// benchmark reporting
+	struct bench_frame
+	{
+		attoseconds_t   emutime;                    // emulated time covered by the frame
+		osd_ticks_t     realtime;                   // host time taken by the frame
+	};
+	std::string         m_bench_report;             // filename for the JSON report (empty if disabled)
+	std::vector<bench_frame> m_bench_frames;        // per-frame timings
+	osd_ticks_t         m_bench_last_ticks;         // host time at the end of the previous frame
+	attotime            m_bench_last_emutime;       // emulated time at the end of the previous frame
+
 	static const bool   s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS];
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
@@ -28,6 +28,7 @@
 
 #include "corestr.h"
 
+#include <algorithm>
 #include <cstring>
 #include <thread>
 
@@ -577,6 +578,11 @@ void lua_engine::on_machine_start()
 void lua_engine::on_machine_stop()
 {
 	execute_function("LUA_ON_STOP");
+
+	// coroutines still waiting on frames will never be resumed
+	for (auto const &waiter : m_frame_waiters)
+		luaL_unref(m_lua_state, LUA_REGISTRYINDEX, waiter.first);
+	m_frame_waiters.clear();
 }
 
 void lua_engine::on_machine_before_load_settings()
@@ -597,6 +603,25 @@ void lua_engine::on_machine_resume()
 void lua_engine::on_machine_frame()
 {
 	execute_function("LUA_ON_FRAME");
+
+	// count down coroutines waiting on frames; collect expired ones first since resuming may wait again
+	if (!m_frame_waiters.empty())
+	{
+		std::vector<int> expired;
+		auto const end = std::remove_if(
+				m_frame_waiters.begin(),
+				m_frame_waiters.end(),
+				[&expired] (std::pair<int, unsigned> &waiter)
+				{
+					if (--waiter.second)
+						return false;
+					expired.emplace_back(waiter.first);
+					return true;
+				});
+		m_frame_waiters.erase(end, m_frame_waiters.end());
+		for (int ref : expired)
+			resume(nullptr, ref);
+	}
 }
 
 void lua_engine::on_frame_done()
@@ -635,6 +660,20 @@ bool lua_engine::on_missing_mandatory_image(const std::string &instance_name)
 	return handled;
 }
 
+void lua_engine::on_state_saved(const char *filename, bool success)
+{
+	enumerate_functions("LUA_ON_STATE_SAVED", [this, filename, success](const sol::protected_function &func)
+	{
+		auto ret = invoke(func, filename, success);
+		if(!ret.valid())
+		{
+			sol::error err = ret;
+			osd_printf_error("[LUA ERROR] in on_state_saved: %s\n", err.what());
+		}
+		return true;
+	});
+}
+
 void lua_engine::attach_notifiers()
 {
 	machine().add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&lua_engine::on_machine_prestart, this), true);
@@ -684,6 +723,7 @@ void lua_engine::initialize()
  * emu.step() - advance one frame
  * emu.keypost(keys) - post keys to natural keyboard
  * emu.wait(len) - wait for len within coroutine
+ * emu.wait_frames(count) - wait for count frames within coroutine
  * emu.lang_translate(str) - get translation for str if available
  * emu.subst_env(str) - substitute environment variables with values for str (semantics are OS-specific)
  *
@@ -696,6 +736,7 @@ void lua_engine::initialize()
  * emu.register_frame_done(callback) - register callback after frame is drawn to screen (for overlays)
  * emu.register_sound_update(callback) - register callback after sound update has generated new samples
  * emu.register_periodic(callback) - register periodic callback while program is running
+ * emu.register_state_saved(callback) - register callback(filename, success) after a save state file is written and closed
  * emu.register_callback(callback, name) - register callback to be used by MAME via lua_engine::call_plugin()
  * emu.register_menu(event_callback, populate_callback, name) - register callbacks for plugin menu
  * emu.register_mandatory_file_manager_override(callback) - register callback invoked to override mandatory file manager
@@ -749,6 +790,7 @@ void lua_engine::initialize()
 	emu["register_frame_done"] = [this] (sol::function func) { register_function(func, "LUA_ON_FRAME_DONE"); };
 	emu["register_sound_update"] = [this] (sol::function func) { register_function(func, "LUA_ON_SOUND_UPDATE"); };
 	emu["register_periodic"] = [this] (sol::function func) { register_function(func, "LUA_ON_PERIODIC"); };
+	emu["register_state_saved"] = [this] (sol::function func) { register_function(func, "LUA_ON_STATE_SAVED"); };
 	emu["register_mandatory_file_manager_override"] = [this] (sol::function func) { register_function(func, "LUA_ON_MANDATORY_FILE_MANAGER_OVERRIDE"); };
 	emu["register_before_load_settings"] = [this](sol::function func) { register_function(func, "LUA_ON_BEFORE_LOAD_SETTINGS"); };
 	emu["register_menu"] =
@@ -797,6 +839,18 @@ void lua_engine::initialize()
 				engine->machine().scheduler().timer_set(attotime::from_double(lua_tonumber(L, 1)), timer_expired_delegate(FUNC(lua_engine::resume), engine), ref, nullptr);
 				return lua_yield(L, 0);
 			});
+	emu["wait_frames"] = lua_CFunction(
+			[] (lua_State *L)
+			{
+				lua_engine *engine = mame_machine_manager::instance()->lua();
+				luaL_argcheck(L, lua_isinteger(L, 1) && (lua_tointeger(L, 1) > 0), 1, "positive frame count expected");
+				int ret = lua_pushthread(L);
+				if (ret == 1)
+					return luaL_error(L, "cannot wait from outside coroutine");
+				int ref = luaL_ref(L, LUA_REGISTRYINDEX);
+				engine->m_frame_waiters.emplace_back(ref, unsigned(lua_tointeger(L, 1)));
+				return lua_yield(L, 0);
+			});
 	emu["lang_translate"] = &lang_translate;
 	emu["pid"] = &osd_getpid;
 	emu["subst_env"] =
@@ -1225,7 +1279,7 @@ void lua_engine::initialize()
 	machine_type["exit"] = &running_machine::schedule_exit;
 	machine_type["hard_reset"] = &running_machine::schedule_hard_reset;
 	machine_type["soft_reset"] = &running_machine::schedule_soft_reset;
-	machine_type["save"] = &running_machine::schedule_save; // TODO: some kind of completion notification?
+	machine_type["save"] = &running_machine::schedule_save; // completion is reported through emu.register_state_saved
 	machine_type["load"] = &running_machine::schedule_load; // TODO: some kind of completion notification?
 	machine_type["buffer_save"] =
 		[] (running_machine &m, sol::this_state s)
@@ -1271,6 +1325,7 @@ void lua_engine::initialize()
 		};
 	machine_type["logerror"]  = [] (running_machine &m, std::string const *str) { m.logerror("[luaengine] %s\n", str); };
 	machine_type["system"] = sol::property(&running_machine::system);
+	machine_type["scheduler"] = sol::property(&running_machine::scheduler);
 	machine_type["video"] = sol::property(&running_machine::video);
 	machine_type["sound"] = sol::property(&running_machine::sound);
 	machine_type["render"] = sol::property(&running_machine::render);
@@ -1667,6 +1722,28 @@ void lua_engine::initialize()
 	parameters_type["lookup"] = &parameters_manager::lookup;
 
 
+	auto scheduler_type = sol().registry().new_usertype<device_scheduler>("scheduler", sol::no_constructor);
+	scheduler_type["stats"] =
+		[this] (device_scheduler &sched)
+		{
+			sol::table table = sol().create_table();
+			for (device_scheduler::device_stats const &dev : sched.stats())
+			{
+				sol::table entry = sol().create_table();
+				entry["cycles"] = dev.cycles;
+				entry["timeslices"] = dev.timeslices;
+				entry["seconds"] = dev.seconds;
+				entry["aborts"] = dev.aborts;
+				entry["boosts"] = dev.boosts;
+				table[dev.device->device().tag()] = entry;
+			}
+			return table;
+		};
+	scheduler_type["time"] = sol::property(&device_scheduler::time);
+	scheduler_type["profiling"] = sol::property(&device_scheduler::profiling_devices);
+	scheduler_type["total_boosts"] = sol::property(&device_scheduler::total_boosts);
+
+
 	auto video_type = sol().registry().new_usertype<video_manager>("video", sol::no_constructor);
 	video_type["frame_update"] = [] (video_manager &vm) { vm.frame_update(true); };
 	video_type["snapshot"] = &video_manager::save_active_screen_snapshots;
@@ -1746,6 +1823,27 @@ void lua_engine::initialize()
 			&sound_manager::attenuation,
 			&sound_manager::set_attenuation);
 	sound_type["recording"] = sol::property(&sound_manager::is_recording);
+	sound_type["stream_stats"] =
+		[] (sound_manager &sm, sol::this_state s)
+		{
+			sol::table result = sol::state_view(s).create_table();
+			auto const add = [&result, &s] (sound_stream const &stream)
+			{
+				sol::table entry = sol::state_view(s).create_table();
+				entry["name"] = stream.name();
+				entry["device"] = stream.device().tag();
+				entry["samples"] = stream.update_samples();
+				entry["seconds"] = double(stream.update_ticks()) / double(osd_ticks_per_second());
+				result.add(entry);
+			};
+			for (auto const &stream : sm.streams())
+			{
+				add(*stream);
+				for (auto const &resampler : stream->resamplers())
+					add(*resampler);
+			}
+			return result;
+		};
 
 
 	auto ui_type = sol().registry().new_usertype<mame_ui_manager>("ui", sol::no_constructor);
@@ -17,6 +17,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #if defined(__GNUC__) && (__GNUC__ > 6)
@@ -59,6 +60,7 @@ public:
 	void on_frame_done();
 	void on_sound_update();
 	void on_periodic();
+	void on_state_saved(const char *filename, bool success);
 	bool on_missing_mandatory_image(const std::string &instance_name);
 	void on_machine_before_load_settings();
 
@@ -148,6 +150,7 @@ private:
 	running_machine *m_machine;
 
 	std::vector<std::string> m_menu;
+	std::vector<std::pair<int, unsigned>> m_frame_waiters;
 
 	template <typename R, typename T, typename D>
 	auto make_simple_callback_setter(void (T::*setter)(delegate<R ()> &&), D &&dflt, const char *name, const char *desc);
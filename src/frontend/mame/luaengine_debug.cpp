@@ -205,6 +205,27 @@ void lua_engine::initialize_debug(sol::table &emu)
 				table[wpp->index()] = sol::make_reference(sol(), *wpp);
 			return table;
 		};
+	device_debug_type["coverage_enabled"] = sol::property(&device_debug::coverage_enabled, &device_debug::set_coverage);
+	device_debug_type["coverage_clear"] = &device_debug::coverage_clear;
+	device_debug_type["coverage"] =
+		[this] (device_debug &dev)
+		{
+			// snapshot of execution counts indexed by PC
+			sol::table table = sol().create_table();
+			for (auto const &entry : dev.coverage_snapshot())
+				table[entry.first] = entry.second;
+			return table;
+		};
+	device_debug_type["coverage_diff"] =
+		[this] (device_debug &dev, sol::table base)
+		{
+			// PCs executed now that an earlier snapshot doesn't have
+			sol::table table = sol().create_table();
+			for (auto const &entry : dev.coverage_snapshot())
+				if (!base[entry.first].valid())
+					table[entry.first] = entry.second;
+			return table;
+		};
 
 
 	auto breakpoint_type = sol().registry().new_usertype<debug_breakpoint>("breakpoint", sol::no_constructor);
@@ -517,6 +517,42 @@ void lua_engine::initialize_memory(sol::table &emu)
 			luaL_pushresultsize(&buff, byte_count);
 			return sol::make_reference(L, sol::stack_reference(L, -1));
 		};
+	addr_space_type["read_list"] =
+		[] (addr_space &sp, sol::this_state s, sol::table addrs, sol::object opt_width) -> sol::object
+		{
+			// entries are either an address, read at the default width, or an { address, width } pair
+			lua_State *L = s;
+			int const defwidth = opt_width.is<int>() ? opt_width.as<int>() : 8;
+			std::size_t const count = addrs.size();
+			sol::table result = sol::state_view(L).create_table(count, 0);
+			for (std::size_t i = 1; i <= count; i++)
+			{
+				sol::object const entry = addrs[i];
+				offs_t address;
+				int width = defwidth;
+				if (entry.is<sol::table>())
+				{
+					sol::table const pair = entry.as<sol::table>();
+					address = pair.get<offs_t>(1);
+					width = pair.get_or(2, defwidth);
+				}
+				else
+				{
+					address = entry.as<offs_t>();
+				}
+				switch (width)
+				{
+				case 8: result[i] = sp.mem_read<u8>(address); break;
+				case 16: result[i] = sp.mem_read<u16>(address); break;
+				case 32: result[i] = sp.mem_read<u32>(address); break;
+				case 64: result[i] = sp.mem_read<u64>(address); break;
+				default:
+					luaL_error(L, "Invalid width. Must be 8/16/32/64");
+					return sol::lua_nil;
+				}
+			}
+			return result;
+		};
 	addr_space_type["name"] = sol::property([] (addr_space &sp) { return sp.space.name(); });
 	addr_space_type["shift"] = sol::property([] (addr_space &sp) { return sp.space.addr_shift(); });
 	addr_space_type["index"] = sol::property([] (addr_space &sp) { return sp.space.spacenum(); });
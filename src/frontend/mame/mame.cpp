@@ -426,6 +426,11 @@ void emulator_info::sound_hook()
 	return mame_machine_manager::instance()->lua()->on_sound_update();
 }
 
+void emulator_info::state_saved_hook(const char *filename, bool success)
+{
+	return mame_machine_manager::instance()->lua()->on_state_saved(filename, success);
+}
+
 void emulator_info::layout_script_cb(layout_file &file, const char *script)
 {
 	// TODO: come up with a better way to pass multiple arguments to plugin
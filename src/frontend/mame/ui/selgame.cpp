@@ -1025,11 +1025,20 @@ void menu_select_game::populate_search()
 		}
 	}
 
-	// sort according to edit distance
-	std::stable_sort(
-			m_searchlist.begin(),
-			m_searchlist.end(),
-			[] (auto const &lhs, auto const &rhs) { return lhs.first < rhs.first; });
+	// sort according to edit distance, breaking ties by position in the sorted list
+	auto const compare =
+			[] (auto const &lhs, auto const &rhs)
+			{
+				if (lhs.first != rhs.first)
+					return lhs.first < rhs.first;
+				return &lhs.second.get() < &rhs.second.get();
+			};
+
+	// without a filter only the best matches get displayed, so there's no need to sort the rest
+	if (m_persistent_data.filter_data().get_current_filter() || (MAX_VISIBLE_SEARCH >= m_searchlist.size()))
+		std::sort(m_searchlist.begin(), m_searchlist.end(), compare);
+	else
+		std::partial_sort(m_searchlist.begin(), std::next(m_searchlist.begin(), MAX_VISIBLE_SEARCH), m_searchlist.end(), compare);
 }
 
 //-------------------------------------------------
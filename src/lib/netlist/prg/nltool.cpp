@@ -22,6 +22,7 @@
 
 #include "plib/ptests.h"
 
+#include <array>
 #include <cstdio> // scanf
 #include <iomanip> // scanf
 #include <ios>
@@ -46,7 +47,7 @@ public:
 		m_errors(0),
 
 		opt_grp1(*this,     "General options",              "The following options apply to all commands."),
-		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","listdevices","listmodels","static","header","docheader","tests"}), "run|validate|convert|listdevices|listmodels|static|header|docheader|tests"),
+		opt_cmd (*this,     "c", "cmd",         0,          std::vector<pstring>({"run","validate","convert","listdevices","listmodels","static","header","docheader","tests","bench"}), "run|validate|convert|listdevices|listmodels|static|header|docheader|tests|bench"),
 		opt_includes(*this, "I", "include",                 "Add the directory to the list of directories to be searched for header files. This option may be specified repeatedly."),
 		opt_defines(*this,  "D", "define",                  "predefine value as macro, e.g. -Dname=value. If '=value' is omitted predefine it as 1. This option may be specified repeatedly."),
 		opt_rfolders(*this, "r", "rom",                     "where to look for data files"),
@@ -60,7 +61,7 @@ public:
 		opt_version(*this,  "",  "version",                 "display version and exit"),
 		opt_help(*this,     "h", "help",                    "display help and exit"),
 
-		opt_grp2(*this,     "Options for run and static commands",   "These options apply to run and static commands."),
+		opt_grp2(*this,     "Options for run, static and bench commands",   "These options apply to run, static and bench commands."),
 		opt_name(*this,     "n", "name",        "",         "the netlist in file specified by ""-f"" option to run; default is first one"),
 
 		opt_grp3(*this,     "Options for static command",   "These options apply to static command."),
@@ -88,6 +89,10 @@ public:
 		opt_linewidth(*this,"", "line-width", 72,            "Line width for output."),
 		opt_pattern(*this, "", "pattern",                    "Pattern to match against device names. If the device name contains pattern, the device will be included in the output. Multiple patterns can be specified, if none is given, all devices will be output."),
 
+		opt_grp8(*this,     "Options for bench command",     "These options are only used by the bench command. The run time is set with --time_to_run."),
+		opt_format(*this,   "", "format",       0,           std::vector<pstring>({"csv","json"}), "output format of the results: csv,json"),
+		opt_solver(*this,   "", "solver",      "Solver",     "name of the solver device whose METHOD parameter is changed for each run"),
+
 		opt_ex1(*this,     "nltool -c run -t 3.5 -n cap_delay nl_examples/cdelay.c",
 				"Run netlist \"cap_delay\" from file nl_examples/cdelay.c for 3.5 seconds"),
 		opt_ex2(*this,     "nltool --cmd=listdevices",
@@ -97,7 +102,9 @@ public:
 		opt_ex4(*this,     "nltool --cmd static --output src/lib/netlist/generated/static_solvers.cpp src/mame/audio/nl_*.cpp src/mame/machine/nl_*.cpp",
 				"Create static solvers for the MAME project."),
 		opt_ex5(*this,     "nltool --cmd tests",
-			"Run unit tests. In case the unit tests are not linked in, this will do nothing.")
+			"Run unit tests. In case the unit tests are not linked in, this will do nothing."),
+		opt_ex6(*this,     "nltool --cmd bench -t 5 --format json src/lib/netlist/examples/*.c* src/mame/audio/nl_*.cpp",
+			"Run each netlist for 5 seconds with every solver type and report the results as JSON.")
 		{}
 
 	int execute() override;
@@ -156,11 +163,17 @@ private:
 	plib::option_num<unsigned> opt_tabwidth;
 	plib::option_num<unsigned> opt_linewidth;
 	plib::option_vec     opt_pattern;
+
+	plib::option_group  opt_grp8;
+	plib::option_str_limit<unsigned> opt_format;
+	plib::option_str    opt_solver;
+
 	plib::option_example opt_ex1;
 	plib::option_example opt_ex2;
 	plib::option_example opt_ex3;
 	plib::option_example opt_ex4;
 	plib::option_example opt_ex5;
+	plib::option_example opt_ex6;
 
 	struct compile_map_entry
 	{
@@ -180,10 +193,13 @@ private:
 	void validate();
 	void convert();
 
+	std::vector<pstring> netlist_names(const pstring &file);
+
 	void compile_one_and_add_to_map(const pstring &file,
 		const pstring &name, netlist::solver::static_compile_target target,
 		compile_map &map);
 	void static_compile();
+	void bench();
 
 	void mac_out(const pstring &s, bool cont = true);
 	void header_entry(const netlist::factory::element_t *e);
@@ -251,7 +267,8 @@ public:
 			const std::vector<pstring> &logs,
 			const std::vector<pstring> &defines,
 			const std::vector<pstring> &roms,
-			const std::vector<pstring> &includes)
+			const std::vector<pstring> &includes,
+			const std::vector<std::pair<pstring, pstring>> &params = {})
 	{
 		// read the netlist ...
 
@@ -266,6 +283,8 @@ public:
 
 		parser().register_source<netlist::source_file_t>(filename);
 		parser().include(name);
+		for (const auto & p : params)
+			parser().register_param(p.first, p.second);
 		parser().register_dynamic_log_devices(logs);
 
 		// start devices
@@ -619,6 +638,42 @@ void tool_app_t::compile_one_and_add_to_map(const pstring &file,
 	}
 }
 
+std::vector<pstring> tool_app_t::netlist_names(const pstring &file)
+{
+	std::vector<pstring> names;
+	if (opt_name.was_specified())
+		names.push_back(opt_name());
+	else
+	{
+		plib::putf8_reader r = plib::putf8_reader(std::make_unique<plib::ifstream>(plib::filesystem::u8path(file)));
+		if (r.stream().fail())
+			throw netlist::nl_exception(netlist::MF_FILE_OPEN_ERROR(file));
+		r.stream().imbue(std::locale::classic());
+		putf8string line;
+		while (r.readline(line))
+		{
+			if (plib::startsWith(line, "//NL_CONTAINS "))
+			{
+				auto sp = plib::psplit(pstring(plib::trim(line.substr(13))), ' ', true);
+				for (auto &e : sp)
+					names.push_back(e);
+			}
+		}
+
+		// MAME netlists are named after their file, for everything else
+		// use the first netlist found in the file.
+		if (names.empty())
+		{
+			pstring name = plib::util::basename(file, ".cpp");
+			if (plib::startsWith(name, "nl_"))
+				names.push_back(name.substr(3));
+			else
+				names.emplace_back("");
+		}
+	}
+	return names;
+}
+
 void tool_app_t::static_compile()
 {
 
@@ -648,36 +703,7 @@ void tool_app_t::static_compile()
 
 		for (const auto &f : opt_files())
 		{
-			std::vector<pstring> names;
-			if (opt_name.was_specified())
-				names.push_back(opt_name());
-			else
-			{
-				plib::putf8_reader r = plib::putf8_reader(std::make_unique<plib::ifstream>(plib::filesystem::u8path(f)));
-				if (r.stream().fail())
-					throw netlist::nl_exception(netlist::MF_FILE_OPEN_ERROR(f));
-				r.stream().imbue(std::locale::classic());
-				putf8string line;
-				while (r.readline(line))
-				{
-					if (plib::startsWith(line, "//NL_CONTAINS "))
-					{
-						auto sp = plib::psplit(pstring(plib::trim(line.substr(13))), ' ', true);
-						for (auto &e : sp)
-							names.push_back(e);
-					}
-				}
-
-				if (names.empty())
-				{
-					pstring name = plib::util::basename(f, ".cpp");
-					if (plib::startsWith(name, "nl_"))
-						name = name.substr(3);
-					names.push_back(name);
-				}
-
-			}
-			for (auto &name : names)
+			for (auto &name : netlist_names(f))
 			{
 				if (!opt_quiet())
 					pout("Processing {}({}) ... \n", name, f);
@@ -712,6 +738,121 @@ void tool_app_t::static_compile()
 	}
 }
 
+void tool_app_t::bench()
+{
+	struct bench_config_t
+	{
+		const char *m_label;
+		const char *m_method;
+		const char *m_boostlib;
+	};
+
+	// "static" uses the precompiled solvers linked into nltool where
+	// available and falls back to the generic MAT_CR solver otherwise.
+	static const std::array<bench_config_t, 5> configs = {{
+		{ "GCR",    "MAT_CR", "generic" },
+		{ "static", "MAT_CR", "builtin" },
+		{ "direct", "MAT",    "generic" },
+		{ "SOR",    "SOR",    "generic" },
+		{ "GMRES",  "GMRES",  "generic" }
+	}};
+
+	if (opt_files().empty())
+		throw netlist::nl_exception("nltool: bench needs at least one file");
+
+	const bool json = (opt_format.as_string() == "json");
+	const auto ttr = netlist::netlist_time_ext::from_fp(opt_ttr());
+	bool first = true;
+
+	if (json)
+		pout("[\n");
+	else
+		pout("file,netlist,solver,startup,wall,emulated,solvers,nets,ops,calculations,newton_raphson,newton_raphson_fail,vsolver_calls\n");
+
+	for (const auto &f : opt_files())
+	{
+		for (const auto &name : netlist_names(f))
+		{
+			for (const auto &cfg : configs)
+			{
+				try
+				{
+					plib::chrono::timer<plib::chrono::system_ticks> t;
+					t.start();
+
+					netlist_tool_t nt(plib::plog_delegate(&tool_app_t::logger, this), "netlist", pstring(cfg.m_boostlib));
+
+					nt.log().verbose.set_enabled(false);
+					nt.log().info.set_enabled(false);
+					nt.log().warning.set_enabled(false);
+
+					nt.read_netlist(f, name, std::vector<pstring>(),
+							m_defines, opt_rfolders(), opt_includes(),
+							{ std::make_pair(opt_solver() + ".METHOD", pstring(cfg.m_method)) });
+
+					nt.free_setup_resources();
+					nt.exec().reset();
+					t.stop();
+					const auto startup(t.as_seconds<netlist::nl_fptype>());
+
+					t.reset();
+					{
+						auto t_guard(t.guard());
+						nt.exec().process_queue(ttr);
+					}
+					const auto wall(t.as_seconds<netlist::nl_fptype>());
+
+					std::size_t solvers = 0;
+					std::size_t nets = 0;
+					std::size_t ops = 0;
+					std::size_t calculations = 0;
+					std::size_t newton_raphson = 0;
+					std::size_t newton_raphson_fail = 0;
+					std::size_t vsolver_calls = 0;
+					if (nt.exec().solver() != nullptr)
+					{
+						for (const auto &s : nt.exec().solver()->solvers())
+						{
+							solvers++;
+							nets += s->size();
+							ops += s->ops();
+							calculations += s->stat_calculations();
+							newton_raphson += s->stat_newton_raphson();
+							newton_raphson_fail += s->stat_newton_raphson_fail();
+							vsolver_calls += s->stat_vsolver_calls();
+						}
+					}
+
+					nt.exec().stop();
+
+					if (json)
+					{
+						pout("{1}\t{ \"file\": \"{2}\", \"netlist\": \"{3}\", \"solver\": \"{4}\",\n", first ? "" : ",\n", f, name, cfg.m_label);
+						pout("\t  \"startup\": {1:.6f}, \"wall\": {2:.6f}, \"emulated\": {3:.6f},\n", startup, wall, ttr.as_double());
+						pout("\t  \"solvers\": {1}, \"nets\": {2}, \"ops\": {3},\n", solvers, nets, ops);
+						pout("\t  \"calculations\": {1}, \"newton_raphson\": {2}, \"newton_raphson_fail\": {3}, \"vsolver_calls\": {4} }",
+								calculations, newton_raphson, newton_raphson_fail, vsolver_calls);
+					}
+					else
+					{
+						pout("{1},{2},{3},{4:.6f},{5:.6f},{6:.6f},", f, name, cfg.m_label, startup, wall, ttr.as_double());
+						pout("{1},{2},{3},{4},{5},{6},{7}\n", solvers, nets, ops,
+								calculations, newton_raphson, newton_raphson_fail, vsolver_calls);
+					}
+					first = false;
+				}
+				catch (plib::pexception &e)
+				{
+					perr("{} : {} : {} : Netlist exception : {}\n", f, name, cfg.m_label, e.text());
+				}
+			}
+		}
+	}
+
+	if (json)
+		pout("\n]\n");
+}
+
 
 
 // "Description: The Swiss army knife for timing purposes\n"
@@ -1311,6 +1452,8 @@ int tool_app_t::execute()
 			validate();
 		else if (cmd == "static")
 			static_compile();
+		else if (cmd == "bench")
+			bench();
 		else if (cmd == "header")
 			create_header();
 		else if (cmd == "docheader")
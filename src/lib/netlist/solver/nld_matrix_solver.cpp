@@ -220,6 +220,82 @@ namespace solver
 						}
 				}
 				break;
+			case matrix_sort_type_e::MINIMUM_DEGREE:
+				{
+					// Greedy minimum degree ordering: repeatedly eliminate the
+					// net with the fewest uneliminated neighbours, recording the
+					// fill-in its elimination creates. This keeps the fill-in of
+					// the elimination-based solvers low on large, sparse nets.
+
+					std::vector<std::vector<bool>> adj(iN, std::vector<bool>(iN, false));
+					for (std::size_t k = 0; k < iN; k++)
+					{
+						auto &term = m_terms[k];
+						for (std::size_t i = 0; i < term.count(); i++)
+						{
+							auto col = get_net_idx(get_connected_net(term.terms()[i]));
+							if (col >= 0 && static_cast<std::size_t>(col) != k)
+							{
+								adj[k][static_cast<std::size_t>(col)] = true;
+								adj[static_cast<std::size_t>(col)][k] = true;
+							}
+						}
+					}
+
+					std::vector<bool> eliminated(iN, false);
+					std::vector<std::size_t> order;
+					order.reserve(iN);
+					for (std::size_t step = 0; step < iN; step++)
+					{
+						std::size_t best = iN;
+						std::size_t best_degree = iN + 1;
+						for (std::size_t k = 0; k < iN; k++)
+						{
+							if (eliminated[k])
+								continue;
+							std::size_t degree = 0;
+							for (std::size_t j = 0; j < iN; j++)
+								if (!eliminated[j] && adj[k][j])
+									degree++;
+							if (degree < best_degree)
+							{
+								best = k;
+								best_degree = degree;
+							}
+						}
+
+						// eliminating best connects all of its remaining neighbours
+						for (std::size_t a = 0; a < iN; a++)
+							if (!eliminated[a] && adj[best][a])
+								for (std::size_t b = a + 1; b < iN; b++)
+									if (!eliminated[b] && adj[best][b])
+									{
+										adj[a][b] = true;
+										adj[b][a] = true;
+									}
+						eliminated[best] = true;
+						order.push_back(best);
+					}
+
+					// apply the permutation in place
+					std::vector<std::size_t> where(iN);
+					std::vector<std::size_t> who(iN);
+					for (std::size_t k = 0; k < iN; k++)
+						where[k] = who[k] = k;
+					for (std::size_t k = 0; k < iN; k++)
+					{
+						std::size_t from = where[order[k]];
+						if (from != k)
+						{
+							std::swap(m_terms[k], m_terms[from]);
+							where[who[k]] = from;
+							who[from] = who[k];
+							where[order[k]] = k;
+							who[k] = order[k];
+						}
+					}
+				}
+				break;
 			case matrix_sort_type_e::NOSORT:
 				break;
 		}
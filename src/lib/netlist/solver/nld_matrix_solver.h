@@ -40,7 +40,8 @@ namespace solver
 		ASCENDING,
 		DESCENDING,
 		PREFER_IDENTITY_TOP_LEFT,
-		PREFER_BAND_MATRIX
+		PREFER_BAND_MATRIX,
+		MINIMUM_DEGREE
 	)
 
 	PENUM(matrix_type_e,
@@ -310,6 +311,13 @@ namespace solver
 		// return number of floating point operations for solve
 		constexpr std::size_t ops() const { return m_ops; }
 
+		// runtime statistics
+		std::size_t size() const noexcept { return m_terms.size(); }
+		std::size_t stat_calculations() const noexcept { return m_stat_calculations; }
+		std::size_t stat_newton_raphson() const noexcept { return m_stat_newton_raphson; }
+		std::size_t stat_newton_raphson_fail() const noexcept { return m_stat_newton_raphson_fail; }
+		std::size_t stat_vsolver_calls() const noexcept { return m_stat_vsolver_calls; }
+
 	protected:
 		matrix_solver_t(devices::nld_solver &main_solver, const pstring &name,
 			const net_list_t &nets,
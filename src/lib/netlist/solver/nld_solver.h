@@ -60,6 +60,8 @@ namespace devices
 
 		void reschedule(solver::matrix_solver_t *solv, netlist_time ts);
 
+		const std::vector<solver_ptr> &solvers() const noexcept { return m_mat_solvers; }
+
 	private:
 		using params_uptr = solver_arena::unique_ptr<solver::solver_parameters_t>;
 
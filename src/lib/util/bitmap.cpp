@@ -425,27 +425,39 @@ void bitmap_t::fill(uint64_t color, const rectangle &bounds)
 	fill &= m_cliprect;
 	if (!fill.empty())
 	{
+		// rows that span the full pitch are contiguous, so fill them in one go
+		auto const fill_rows =
+				[this, &fill] (auto value)
+				{
+					using PixelType = decltype(value);
+					if ((fill.left() == 0) && (fill.width() == m_rowpixels))
+					{
+						std::fill_n(&pixt<PixelType>(fill.top()), size_t(fill.height()) * m_rowpixels, value);
+					}
+					else
+					{
+						for (int32_t y = fill.top(); y <= fill.bottom(); ++y)
+							std::fill_n(&pixt<PixelType>(y, fill.left()), fill.width(), value);
+					}
+				};
+
 		// based on the bpp go from there
 		switch (m_bpp)
 		{
 		case 8:
-			for (int32_t y = fill.top(); y <= fill.bottom(); y++)
-				std::fill_n(&pixt<uint8_t>(y, fill.left()), fill.width(), uint8_t(color));
+			fill_rows(uint8_t(color));
 			break;
 
 		case 16:
-			for (int32_t y = fill.top(); y <= fill.bottom(); ++y)
-				std::fill_n(&pixt<uint16_t>(y, fill.left()), fill.width(), uint16_t(color));
+			fill_rows(uint16_t(color));
 			break;
 
 		case 32:
-			for (int32_t y = fill.top(); y <= fill.bottom(); ++y)
-				std::fill_n(&pixt<uint32_t>(y, fill.left()), fill.width(), uint32_t(color));
+			fill_rows(uint32_t(color));
 			break;
 
 		case 64:
-			for (int32_t y = fill.top(); y <= fill.bottom(); ++y)
-				std::fill_n(&pixt<uint64_t>(y, fill.left()), fill.width(), uint64_t(color));
+			fill_rows(uint64_t(color));
 			break;
 		}
 	}
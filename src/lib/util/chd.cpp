@@ -289,10 +289,13 @@ inline uint8_t chd_file::bits_for_value(uint64_t value)
 
 chd_file::chd_file()
 	: m_file(nullptr),
-		m_owns_file(false)
+		m_owns_file(false),
+		m_cache(DEFAULT_CACHE_HUNKS),
+		m_decompress_queue(nullptr)
 {
 	// reset state
 	memset(m_decompressor, 0, sizeof(m_decompressor));
+	memset(m_thread_decompressor, 0, sizeof(m_thread_decompressor));
 	close();
 }
 
@@ -566,6 +569,24 @@ void chd_file::set_parent_sha1(util::sha1_t parent)
 	file_write(m_parentsha1_offset, rawbuf, sizeof(rawbuf));
 }
 
+/**
+ * @fn  void chd_file::set_cache_hunks(uint32_t count)
+ *
+ * @brief   -------------------------------------------------
+ *            set_cache_hunks - set the number of hunks kept in the cache used for partial
+ *            reads and writes; this discards any hunks currently cached
+ *          -------------------------------------------------.
+ *
+ * @param   count   Number of hunks to cache, at least one.
+ */
+
+void chd_file::set_cache_hunks(uint32_t count)
+{
+	assert(count != 0);
+	util::lru_cache_map<uint32_t, std::vector<uint8_t>> cache(count);
+	m_cache.swap(cache);
+}
+
 /**
  * @fn  chd_error chd_file::create(util::core_file &file, uint64_t logicalbytes, uint32_t hunkbytes, uint32_t unitbytes, chd_codec_type compression[4])
  *
@@ -788,7 +809,6 @@ chd_error chd_file::open(util::core_file &file, bool writeable, chd_file *parent
 	m_file = &file;
 	m_owns_file = false;
 	m_parent = parent;
-	m_cachehunk = ~0;
 	return open_common(writeable);
 }
 
@@ -842,9 +862,21 @@ void chd_file::close()
 	}
 	m_compressed.clear();
 
+	// reset parallel decompression
+	if (m_decompress_queue != nullptr)
+		osd_work_queue_free(m_decompress_queue);
+	m_decompress_queue = nullptr;
+	for (auto & thread : m_thread_decompressor)
+		for (auto & elem : thread)
+		{
+			delete elem;
+			elem = nullptr;
+		}
+	m_decompress_buffer.clear();
+	m_decompress_items.clear();
+
 	// reset caching
 	m_cache.clear();
-	m_cachehunk = ~0;
 }
 
 /**
@@ -996,6 +1028,172 @@ chd_error chd_file::read_hunk(uint32_t hunknum, void *buffer)
 	}
 }
 
+/**
+ * @fn  chd_error chd_file::read_hunks(uint32_t hunknum, uint32_t count, void *buffer)
+ *
+ * @brief   -------------------------------------------------
+ *            read_hunks - read a range of consecutive hunks; for compressed v5 files the
+ *            compressed data is read on this thread and decompressed on worker threads
+ *          -------------------------------------------------.
+ *
+ * @exception   CHDERR_NOT_OPEN             Thrown when a chderr not open error condition occurs.
+ * @exception   CHDERR_HUNK_OUT_OF_RANGE    Thrown when a chderr hunk out of range error
+ *                                          condition occurs.
+ *
+ * @param   hunknum         The first hunk.
+ * @param   count           Number of hunks.
+ * @param [in,out]  buffer  Buffer of at least count * hunk_bytes() bytes.
+ *
+ * @return  A chd_error.
+ */
+
+chd_error chd_file::read_hunks(uint32_t hunknum, uint32_t count, void *buffer)
+{
+	// wrap this for clean reporting
+	try
+	{
+		// punt if no file
+		if (m_file == nullptr)
+			throw CHDERR_NOT_OPEN;
+
+		// return an error if out of range
+		if (hunknum >= m_hunkcount || count > m_hunkcount - hunknum)
+			throw CHDERR_HUNK_OUT_OF_RANGE;
+
+		// lossy codecs need configuring per file, so only handle hunks in any order for
+		// compressed v5 files with lossless codecs
+		auto *dest = reinterpret_cast<uint8_t *>(buffer);
+		bool parallel = (m_version >= 5 && compressed() && count > 1);
+		for (auto & elem : m_decompressor)
+			if (elem != nullptr && elem->lossy())
+				parallel = false;
+		if (!parallel)
+		{
+			for (uint32_t index = 0; index < count; index++)
+			{
+				chd_error err = read_hunk(hunknum + index, &dest[uint64_t(index) * m_hunkbytes]);
+				if (err != CHDERR_NONE)
+					return err;
+			}
+			return CHDERR_NONE;
+		}
+
+		// gather the hunks that need a codec; everything else is read directly further down
+		m_decompress_items.clear();
+		uint64_t compbytes = 0;
+		for (uint32_t index = 0; index < count; index++)
+		{
+			uint8_t *rawmap = &m_rawmap[m_mapentrybytes * (hunknum + index)];
+			if (rawmap[0] > COMPRESSION_TYPE_3)
+				continue;
+
+			decompress_item item;
+			item.m_chd = this;
+			item.m_compoffs = compbytes;
+			item.m_complen = be_read(&rawmap[1], 3);
+			item.m_compression = rawmap[0];
+			item.m_crc = be_read(&rawmap[10], 2);
+			item.m_dest = &dest[uint64_t(index) * m_hunkbytes];
+			item.m_error = CHDERR_NONE;
+			m_decompress_items.push_back(item);
+			compbytes += item.m_complen;
+		}
+
+		// read the compressed data in file order, then hand the hunks to the worker threads
+		if (!m_decompress_items.empty())
+		{
+			m_decompress_buffer.resize(compbytes);
+			for (uint32_t index = 0, itemnum = 0; index < count; index++)
+			{
+				uint8_t *rawmap = &m_rawmap[m_mapentrybytes * (hunknum + index)];
+				if (rawmap[0] <= COMPRESSION_TYPE_3)
+				{
+					decompress_item &item = m_decompress_items[itemnum++];
+					file_read(be_read(&rawmap[4], 6), &m_decompress_buffer[item.m_compoffs], item.m_complen);
+				}
+			}
+
+			if (m_decompress_queue == nullptr)
+				m_decompress_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+			osd_work_item_queue_multiple(m_decompress_queue, async_decompress_hunk_static, m_decompress_items.size(), &m_decompress_items[0], sizeof(m_decompress_items[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		}
+
+		// uncompressed, self and parent hunks are read on this thread
+		chd_error err = CHDERR_NONE;
+		for (uint32_t index = 0; index < count && err == CHDERR_NONE; index++)
+			if (m_rawmap[m_mapentrybytes * (hunknum + index)] > COMPRESSION_TYPE_3)
+				err = read_hunk(hunknum + index, &dest[uint64_t(index) * m_hunkbytes]);
+
+		// wait for the workers even if we failed, since they write into the caller's buffer
+		if (!m_decompress_items.empty())
+		{
+			while (!osd_work_queue_wait(m_decompress_queue, osd_ticks_per_second())) { }
+			for (auto & item : m_decompress_items)
+				if (err == CHDERR_NONE)
+					err = item.m_error;
+		}
+		return err;
+	}
+
+	// just return errors
+	catch (chd_error &err)
+	{
+		return err;
+	}
+}
+
+/**
+ * @fn  void *chd_file::async_decompress_hunk_static(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            async_decompress_hunk - decompress a single hunk for read_hunks on a worker
+ *            thread using that thread's codecs
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  param   If non-null, the parameter.
+ * @param   threadid        The threadid.
+ *
+ * @return  null if it fails, else a void*.
+ */
+
+void *chd_file::async_decompress_hunk_static(void *param, int threadid)
+{
+	auto *item = reinterpret_cast<decompress_item *>(param);
+	item->m_chd->async_decompress_hunk(*item, threadid);
+	return nullptr;
+}
+
+/**
+ * @fn  void chd_file::async_decompress_hunk(decompress_item &item, int threadid)
+ *
+ * @brief   Asynchronous decompress hunk.
+ *
+ * @param [in,out]  item    The item.
+ * @param   threadid        The threadid.
+ */
+
+void chd_file::async_decompress_hunk(decompress_item &item, int threadid)
+{
+	assert(threadid < std::size(m_thread_decompressor));
+	try
+	{
+		// codecs are created on first use by the thread that owns them
+		chd_decompressor *&decompressor = m_thread_decompressor[threadid][item.m_compression];
+		if (decompressor == nullptr)
+			decompressor = chd_codec_list::new_decompressor(m_compression[item.m_compression], *this);
+		if (decompressor == nullptr)
+			throw CHDERR_UNKNOWN_COMPRESSION;
+
+		decompressor->decompress(&m_decompress_buffer[item.m_compoffs], item.m_complen, item.m_dest, m_hunkbytes);
+		if (util::crc16_creator::simple(item.m_dest, m_hunkbytes) != item.m_crc)
+			throw CHDERR_DECOMPRESSION_ERROR;
+	}
+	catch (chd_error &err)
+	{
+		item.m_error = err;
+	}
+}
+
 /**
  * @fn  chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
  *
@@ -1036,6 +1234,11 @@ chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
 		if (compressed())
 			throw CHDERR_FILE_NOT_WRITEABLE;
 
+		// keep any cached copy of this hunk in sync
+		auto const cached(m_cache.find(hunknum));
+		if (cached != m_cache.end() && buffer != &cached->second[0])
+			memcpy(&cached->second[0], buffer, m_hunkbytes);
+
 		// see if we have allocated the space on disk for this hunk
 		uint8_t *rawmap = &m_rawmap[hunknum * 4];
 		uint32_t rawentry = be_read(rawmap, 4);
@@ -1063,10 +1266,6 @@ chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
 			// write the map entry back
 			be_write(rawmap, rawentry, 4);
 			file_write(m_mapoffset + hunknum * 4, rawmap, 4);
-
-			// update the cached hunk if we just wrote it
-			if (hunknum == m_cachehunk && buffer != &m_cache[0])
-				memcpy(&m_cache[0], buffer, m_hunkbytes);
 		}
 
 		// otherwise, just overwrite
@@ -1082,6 +1281,50 @@ chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
 	}
 }
 
+/**
+ * @fn  chd_error chd_file::read_cached_hunk(uint32_t hunknum, uint8_t *&data)
+ *
+ * @brief   -------------------------------------------------
+ *            read_cached_hunk - return a pointer to the given hunk in the cache, reading it
+ *            and dropping the least recently used hunk if necessary
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [out] data        Receives a pointer to the cached hunk data.
+ *
+ * @return  A chd_error.
+ */
+
+chd_error chd_file::read_cached_hunk(uint32_t hunknum, uint8_t *&data)
+{
+	// find freshens the entry if it's already there
+	auto const found(m_cache.find(hunknum));
+	if (found != m_cache.end())
+	{
+		data = &found->second[0];
+		return CHDERR_NONE;
+	}
+
+	// recycle the buffer of the least recently used hunk if the cache is full
+	std::vector<uint8_t> buffer;
+	if (m_cache.size() >= m_cache.max_size())
+	{
+		buffer.swap(m_cache.begin()->second);
+		m_cache.erase(m_cache.begin());
+	}
+	buffer.resize(m_hunkbytes);
+
+	// only add the hunk once it has been read successfully
+	chd_error err = read_hunk(hunknum, &buffer[0]);
+	if (err != CHDERR_NONE)
+		return err;
+
+	std::vector<uint8_t> &entry(m_cache[hunknum]);
+	entry.swap(buffer);
+	data = &entry[0];
+	return CHDERR_NONE;
+}
+
 /**
  * @fn  chd_error chd_file::read_units(uint64_t unitnum, void *buffer, uint32_t count)
  *
@@ -1147,22 +1390,22 @@ chd_error chd_file::read_bytes(uint64_t offset, void *buffer, uint32_t bytes)
 		uint32_t startoffs = (curhunk == first_hunk) ? (offset % m_hunkbytes) : 0;
 		uint32_t endoffs = (curhunk == last_hunk) ? ((offset + bytes - 1) % m_hunkbytes) : (m_hunkbytes - 1);
 
-		// if it's a full block, just read directly from disk unless it's the cached hunk
+		// if it's a full block, just read directly from disk unless it's a cached hunk
 		chd_error err = CHDERR_NONE;
-		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && curhunk != m_cachehunk)
+		auto const cached(m_cache.find(curhunk));
+		if (cached != m_cache.end())
+			memcpy(dest, &cached->second[startoffs], endoffs + 1 - startoffs);
+		else if (startoffs == 0 && endoffs == m_hunkbytes - 1)
 			err = read_hunk(curhunk, dest);
 
-		// otherwise, read from the cache
+		// otherwise, read through the cache
 		else
 		{
-			if (curhunk != m_cachehunk)
-			{
-				err = read_hunk(curhunk, &m_cache[0]);
-				if (err != CHDERR_NONE)
-					return err;
-				m_cachehunk = curhunk;
-			}
-			memcpy(dest, &m_cache[startoffs], endoffs + 1 - startoffs);
+			uint8_t *data;
+			err = read_cached_hunk(curhunk, data);
+			if (err != CHDERR_NONE)
+				return err;
+			memcpy(dest, &data[startoffs], endoffs + 1 - startoffs);
 		}
 
 		// handle errors and advance
@@ -1200,23 +1443,20 @@ chd_error chd_file::write_bytes(uint64_t offset, const void *buffer, uint32_t by
 		uint32_t startoffs = (curhunk == first_hunk) ? (offset % m_hunkbytes) : 0;
 		uint32_t endoffs = (curhunk == last_hunk) ? ((offset + bytes - 1) % m_hunkbytes) : (m_hunkbytes - 1);
 
-		// if it's a full block, just write directly to disk unless it's the cached hunk
+		// if it's a full block, just write directly to disk; write_hunk updates any cached copy
 		chd_error err = CHDERR_NONE;
-		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && curhunk != m_cachehunk)
+		if (startoffs == 0 && endoffs == m_hunkbytes - 1)
 			err = write_hunk(curhunk, source);
 
 		// otherwise, write from the cache
 		else
 		{
-			if (curhunk != m_cachehunk)
-			{
-				err = read_hunk(curhunk, &m_cache[0]);
-				if (err != CHDERR_NONE)
-					return err;
-				m_cachehunk = curhunk;
-			}
-			memcpy(&m_cache[startoffs], source, endoffs + 1 - startoffs);
-			err = write_hunk(curhunk, &m_cache[0]);
+			uint8_t *data;
+			err = read_cached_hunk(curhunk, data);
+			if (err != CHDERR_NONE)
+				return err;
+			memcpy(&data[startoffs], source, endoffs + 1 - startoffs);
+			err = write_hunk(curhunk, data);
 		}
 
 		// handle errors and advance
@@ -2467,9 +2707,8 @@ void chd_file::create_open_common()
 	else
 		file_read(m_mapoffset, &m_rawmap[0], m_rawmap.size());
 
-	// allocate the temporary compressed buffer and a buffer for caching
+	// allocate the temporary compressed buffer
 	m_compressed.resize(m_hunkbytes);
-	m_cache.resize(m_hunkbytes);
 }
 
 /**
@@ -18,6 +18,7 @@
 #include "corefile.h"
 #include "hashing.h"
 #include "chdcodec.h"
+#include "lrucache.h"
 #include <atomic>
 
 /***************************************************************************
@@ -294,6 +295,7 @@ class chd_file
 	static const uint32_t V4_HEADER_SIZE = 108;
 	static const uint32_t V5_HEADER_SIZE = 124;
 	static const uint32_t MAX_HEADER_SIZE = V5_HEADER_SIZE;
+	static const uint32_t DEFAULT_CACHE_HUNKS = 8;
 
 public:
 	// construction/destruction
@@ -322,6 +324,7 @@ public:
 	// setters
 	void set_raw_sha1(util::sha1_t rawdata);
 	void set_parent_sha1(util::sha1_t parent);
+	void set_cache_hunks(uint32_t count);
 
 	// file create
 	chd_error create(const char *filename, uint64_t logicalbytes, uint32_t hunkbytes, uint32_t unitbytes, chd_codec_type compression[4]);
@@ -338,6 +341,7 @@ public:
 
 	// read/write
 	chd_error read_hunk(uint32_t hunknum, void *buffer);
+	chd_error read_hunks(uint32_t hunknum, uint32_t count, void *buffer);
 	chd_error write_hunk(uint32_t hunknum, const void *buffer);
 	chd_error read_units(uint64_t unitnum, void *buffer, uint32_t count = 1);
 	chd_error write_units(uint64_t unitnum, const void *buffer, uint32_t count = 1);
@@ -368,6 +372,18 @@ private:
 	struct metadata_entry;
 	struct metadata_hash;
 
+	// a hunk to be decompressed on a worker thread
+	struct decompress_item
+	{
+		chd_file *          m_chd;              // pointer back to the file
+		uint64_t            m_compoffs;         // offset of the compressed data in m_decompress_buffer
+		uint32_t            m_complen;          // compressed data length
+		uint8_t             m_compression;      // index of the codec to use
+		util::crc16_t       m_crc;              // CRC-16 of the decompressed data
+		uint8_t *           m_dest;             // where the decompressed data goes
+		chd_error           m_error;            // result of the decompression
+	};
+
 	// inline helpers
 	uint64_t be_read(const uint8_t *base, int numbytes);
 	void be_write(uint8_t *base, uint64_t value, int numbytes);
@@ -389,6 +405,9 @@ private:
 	chd_error open_common(bool writeable);
 	void create_open_common();
 	void verify_proper_compression_append(uint32_t hunknum);
+	chd_error read_cached_hunk(uint32_t hunknum, uint8_t *&data);
+	static void *async_decompress_hunk_static(void *param, int threadid);
+	void async_decompress_hunk(decompress_item &item, int threadid);
 	void hunk_write_compressed(uint32_t hunknum, int8_t compression, const uint8_t *compressed, uint32_t complength, util::crc16_t crc16);
 	void hunk_copy_from_self(uint32_t hunknum, uint32_t otherhunk);
 	void hunk_copy_from_parent(uint32_t hunknum, uint64_t parentunit);
@@ -432,8 +451,13 @@ private:
 	std::vector<uint8_t>          m_compressed;       // temporary buffer for compressed data
 
 	// caching
-	std::vector<uint8_t>          m_cache;            // single-hunk cache for partial reads/writes
-	uint32_t                  m_cachehunk;        // which hunk is in the cache?
+	util::lru_cache_map<uint32_t, std::vector<uint8_t>> m_cache; // recently used hunks for partial reads/writes
+
+	// parallel decompression for read_hunks (one extra codec set for the calling thread)
+	osd_work_queue *        m_decompress_queue; // queue for decompressing on other threads
+	chd_decompressor *      m_thread_decompressor[WORK_MAX_THREADS + 1][4]; // per-thread codecs
+	std::vector<uint8_t>    m_decompress_buffer;// compressed data for the hunks being read
+	std::vector<decompress_item> m_decompress_items; // hunks being decompressed
 };
 
 
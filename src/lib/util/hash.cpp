@@ -12,6 +12,7 @@
 
 #include "hash.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 
@@ -366,11 +367,19 @@ void hash_collection::buffer(const uint8_t *data, uint32_t length)
 {
 	assert(m_creator != nullptr);
 
-	// append to each active hash
-	if (m_creator->m_doing_crc32)
-		m_creator->m_crc32_creator.append(data, length);
-	if (m_creator->m_doing_sha1)
-		m_creator->m_sha1_creator.append(data, length);
+	// append to each active hash a block at a time, so that the second hash
+	// reads data that is still in cache when hashing large files
+	constexpr uint32_t BLOCK_SIZE = 64 * 1024;
+	while (length != 0)
+	{
+		uint32_t const chunk = std::min(length, BLOCK_SIZE);
+		if (m_creator->m_doing_crc32)
+			m_creator->m_crc32_creator.append(data, chunk);
+		if (m_creator->m_doing_sha1)
+			m_creator->m_sha1_creator.append(data, chunk);
+		data += chunk;
+		length -= chunk;
+	}
 }
 
 
@@ -902,10 +902,11 @@ static png_error write_chunk(core_file &fp, const uint8_t *data, uint32_t type,
 
 /*-------------------------------------------------
     write_deflated_chunk - write an in-memory
-    chunk to the given file by deflating it
+    chunk to the given file by deflating it at
+    the given zlib compression level
 -------------------------------------------------*/
 
-static png_error write_deflated_chunk(core_file &fp, uint8_t *data, uint32_t type, uint32_t length)
+static png_error write_deflated_chunk(core_file &fp, uint8_t *data, uint32_t type, uint32_t length, int level)
 {
 	uint64_t lengthpos = fp.tell();
 	uint8_t tempbuff[8192];
@@ -927,7 +928,7 @@ static png_error write_deflated_chunk(core_file &fp, uint8_t *data, uint32_t typ
 	memset(&stream, 0, sizeof(stream));
 	stream.next_in = data;
 	stream.avail_in = length;
-	zerr = deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+	zerr = deflateInit(&stream, level);
 	if (zerr != Z_OK)
 		return png_error::COMPRESS_ERROR;
 
@@ -1129,7 +1130,7 @@ static png_error convert_bitmap_to_image_rgb(png_info &pnginfo, const bitmap_t &
     chunks to the given file
 -------------------------------------------------*/
 
-static png_error write_png_stream(core_file &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette)
+static png_error write_png_stream(core_file &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette, int level)
 {
 	uint8_t tempbuff[16];
 	png_error error;
@@ -1163,7 +1164,7 @@ static png_error write_png_stream(core_file &fp, png_info &pnginfo, const bitmap
 		return error;
 
 	// write a single IDAT chunk
-	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1));
+	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1), level);
 	if (error != png_error::NONE)
 		return error;
 
@@ -1222,7 +1223,7 @@ png_error png_write_bitmap(core_file &fp, png_info *info, bitmap_t const &bitmap
 		return png_error::FILE_ERROR;
 
 	/* write the rest of the PNG data */
-	return write_png_stream(fp, *info, bitmap, palette_length, palette);
+	return write_png_stream(fp, *info, bitmap, palette_length, palette, Z_DEFAULT_COMPRESSION);
 }
 
 
@@ -1276,7 +1277,8 @@ png_error mng_capture_start(core_file &fp, bitmap_t &bitmap, unsigned rate)
 
 png_error mng_capture_frame(core_file &fp, png_info &info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette)
 {
-	return write_png_stream(fp, info, bitmap, palette_length, palette);
+	// frames are written continuously while capturing, so favour speed over size
+	return write_png_stream(fp, info, bitmap, palette_length, palette, Z_BEST_SPEED);
 }
 
 /**
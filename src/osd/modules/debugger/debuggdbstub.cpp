@@ -810,6 +810,26 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_k(const char *buf)
 	return REPLY_NONE;
 }
 
+//-------------------------------------------------------------------------
+static inline void hex_encode(std::string &str, uint8_t value)
+{
+	static const char digits[] = "0123456789abcdef";
+	str += digits[value >> 4];
+	str += digits[value & 0x0f];
+}
+
+//-------------------------------------------------------------------------
+static inline int hex_nibble(char c)
+{
+	if ( c >= '0' && c <= '9' )
+		return c - '0';
+	if ( c >= 'a' && c <= 'f' )
+		return c - 'a' + 10;
+	if ( c >= 'A' && c <= 'F' )
+		return c - 'A' + 10;
+	return -1;
+}
+
 //-------------------------------------------------------------------------
 // Read memory.
 debug_gdbstub::cmd_reply debug_gdbstub::handle_m(const char *buf)
@@ -829,10 +849,7 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_m(const char *buf)
 	std::string reply;
 	reply.reserve(length * 2);
 	for ( int i = 0; i < length; i++ )
-	{
-		uint8_t value = m_address_space->read_byte(offset + i);
-		reply += string_format("%02x", value);
-	}
+		hex_encode(reply, m_address_space->read_byte(offset + i));
 	send_reply(reply.c_str());
 
 	return REPLY_NONE;
@@ -845,8 +862,11 @@ static bool hex_decode(std::vector<uint8_t> *_data, const char *buf, size_t leng
 	data.resize(length);
 	for ( int i = 0; i < length; i++ )
 	{
-		if ( sscanf(buf, "%02hhx", &data[i]) != 1 )
+		int hi = hex_nibble(buf[0]);
+		int lo = (hi >= 0) ? hex_nibble(buf[1]) : -1;
+		if ( lo < 0 )
 			return false;
+		data[i] = (hi << 4) | lo;
 		buf += 2;
 	}
 	if ( *buf != '\0' )
@@ -952,7 +972,7 @@ debug_gdbstub::cmd_reply debug_gdbstub::handle_q(const char *buf)
 			const char *line = text_buffer_get_seqnum_line(textbuf, i);
 			reply.reserve(reply.length() + (strlen(line)+1)*2);
 			while ( *line != '\0' )
-				reply += string_format("%02x", *line++);
+				hex_encode(reply, *line++);
 			reply += "0A";
 		}
 		send_reply(reply.c_str());
@@ -46,7 +46,7 @@ public:
 	sound_sdl() :
 		osd_module(OSD_SOUND_PROVIDER, "sdl"), sound_module(),
 		stream_in_initialized(0),
-		attenuation(0), buf_locked(0), stream_buffer(nullptr), stream_buffer_size(0), buffer_underflows(0), buffer_overflows(0)
+		attenuation(0), stream_buffer(nullptr), stream_buffer_size(0), buffer_underflows(0), buffer_overflows(0)
 {
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
 	}
@@ -61,26 +61,8 @@ public:
 	virtual void set_mastervolume(int attenuation) override;
 
 private:
-	class ring_buffer
-	{
-	public:
-		ring_buffer(size_t size);
-
-		size_t data_size() const { return (tail - head + buffer_size) % buffer_size; }
-		size_t free_size() const { return (head - tail - 1 + buffer_size) % buffer_size; }
-		int append(const void *data, size_t size);
-		int pop(void *data, size_t size);
-
-	private:
-		std::unique_ptr<int8_t []> const buffer;
-		size_t const buffer_size;
-		int head = 0, tail = 0;
-	};
-
 	static void sdl_callback(void *userdata, Uint8 *stream, int len);
 
-	void lock_buffer();
-	void unlock_buffer();
 	void attenuate(int16_t *data, int bytes);
 	void copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy);
 	int sdl_create_buffers();
@@ -90,8 +72,7 @@ private:
 	int stream_in_initialized;
 	int attenuation;
 
-	int              buf_locked;
-	std::unique_ptr<ring_buffer> stream_buffer;
+	std::unique_ptr<sound_ring_buffer> stream_buffer;
 	uint32_t         stream_buffer_size;
 
 
@@ -109,98 +90,10 @@ private:
 // maximum audio latency
 #define MAX_AUDIO_LATENCY       5
 
-//============================================================
-//  ring_buffer - constructor
-//============================================================
-
-sound_sdl::ring_buffer::ring_buffer(size_t size)
-	: buffer(std::make_unique<int8_t []>(size + 1)), buffer_size(size + 1)
-{
-	// A size+1 bytes buffer is allocated because it can never be full.
-	// Otherwise the case head == tail couldn't be distinguished between a
-	// full buffer and an empty buffer.
-	std::fill_n(buffer.get(), size + 1, 0);
-}
-
-//============================================================
-//  ring_buffer::append
-//============================================================
-
-int sound_sdl::ring_buffer::append(const void *data, size_t size)
-{
-	if (free_size() < size)
-		return -1;
-
-	int8_t const *const data8 = reinterpret_cast<int8_t const *>(data);
-	size_t sz = buffer_size - tail;
-	if (size <= sz)
-		sz = size;
-	else
-		std::copy_n(&data8[sz], size - sz, &buffer[0]);
-
-	std::copy_n(data8, sz, &buffer[tail]);
-	tail = (tail + size) % buffer_size;
-
-	return 0;
-}
-
-//============================================================
-//  ring_buffer::pop
-//============================================================
-
-int sound_sdl::ring_buffer::pop(void *data, size_t size)
-{
-	if (data_size() < size)
-		return -1;
-
-	int8_t *const data8 = reinterpret_cast<int8_t *>(data);
-	size_t sz = buffer_size - head;
-	if (size <= sz)
-		sz = size;
-	else
-	{
-		std::copy_n(&buffer[0], size - sz, &data8[sz]);
-		std::fill_n(&buffer[0], size - sz, 0);
-	}
-
-	std::copy_n(&buffer[head], sz, data8);
-	std::fill_n(&buffer[head], sz, 0);
-	head = (head + size) % buffer_size;
-
-	return 0;
-}
-
 //============================================================
 //  sound_sdl - destructor
 //============================================================
 
-//============================================================
-//  lock_buffer
-//============================================================
-void sound_sdl::lock_buffer()
-{
-	if (!buf_locked)
-		SDL_LockAudio();
-	buf_locked++;
-
-	if (LOG_SOUND)
-		*sound_log << "locking\n";
-}
-
-//============================================================
-//  unlock_buffer
-//============================================================
-void sound_sdl::unlock_buffer()
-{
-	buf_locked--;
-	if (!buf_locked)
-		SDL_UnlockAudio();
-
-	if (LOG_SOUND)
-		*sound_log << "unlocking\n";
-
-}
-
 //============================================================
 //  Apply attenuation
 //============================================================
@@ -223,9 +116,9 @@ void sound_sdl::attenuate(int16_t *data, int bytes_to_copy)
 
 void sound_sdl::copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy)
 {
-	lock_buffer();
+	// the ring is single-producer/single-consumer, so the audio
+	// callback never needs to be locked out while we append
 	int const err = stream_buffer->append(data, bytes_to_copy);
-	unlock_buffer();
 
 	if (LOG_SOUND && err)
 		*sound_log << "Late detection of overflow. This shouldn't happen.\n";
@@ -442,8 +335,7 @@ int sound_sdl::sdl_create_buffers()
 {
 	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u bytes\n", stream_buffer_size);
 
-	stream_buffer = std::make_unique<ring_buffer>(stream_buffer_size);
-	buf_locked = 0;
+	stream_buffer = std::make_unique<sound_ring_buffer>(stream_buffer_size);
 	return 0;
 }
 
@@ -11,12 +11,84 @@
 #include "osdepend.h"
 #include "modules/osdmodule.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
 //============================================================
 //  CONSTANTS
 //============================================================
 
 #define OSD_SOUND_PROVIDER   "sound"
 
+//============================================================
+//  sound_ring_buffer - single-producer, single-consumer
+//  byte ring shared between update_audio_stream and an
+//  audio callback thread; no locking is needed as long as
+//  only one thread appends and only one thread pops
+//============================================================
+
+class sound_ring_buffer
+{
+public:
+	// a size+1 byte buffer is allocated so head == tail always means empty
+	sound_ring_buffer(size_t size)
+		: m_buffer(std::make_unique<int8_t []>(size + 1)), m_buffer_size(size + 1), m_head(0), m_tail(0)
+	{
+		std::fill_n(m_buffer.get(), size + 1, 0);
+	}
+
+	size_t data_size() const { return (m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire) + m_buffer_size) % m_buffer_size; }
+	size_t free_size() const { return (m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire) - 1 + m_buffer_size) % m_buffer_size; }
+
+	// producer side
+	int append(const void *data, size_t size)
+	{
+		size_t const tail = m_tail.load(std::memory_order_relaxed);
+		if (free_size() < size)
+			return -1;
+
+		int8_t const *const data8 = reinterpret_cast<int8_t const *>(data);
+		size_t sz = m_buffer_size - tail;
+		if (size <= sz)
+			sz = size;
+		else
+			std::copy_n(&data8[sz], size - sz, &m_buffer[0]);
+		std::copy_n(data8, sz, &m_buffer[tail]);
+
+		// publish the data only once it has been written
+		m_tail.store((tail + size) % m_buffer_size, std::memory_order_release);
+		return 0;
+	}
+
+	// consumer side
+	int pop(void *data, size_t size)
+	{
+		size_t const head = m_head.load(std::memory_order_relaxed);
+		if (data_size() < size)
+			return -1;
+
+		int8_t *const data8 = reinterpret_cast<int8_t *>(data);
+		size_t sz = m_buffer_size - head;
+		if (size <= sz)
+			sz = size;
+		else
+			std::copy_n(&m_buffer[0], size - sz, &data8[sz]);
+		std::copy_n(&m_buffer[head], sz, data8);
+
+		// release the space only once it has been read
+		m_head.store((head + size) % m_buffer_size, std::memory_order_release);
+		return 0;
+	}
+
+private:
+	std::unique_ptr<int8_t []> const m_buffer;
+	size_t const m_buffer_size;
+	std::atomic<size_t> m_head;     // written only by the consumer
+	std::atomic<size_t> m_tail;     // written only by the producer
+};
+
 class sound_module
 {
 public:
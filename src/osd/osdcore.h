@@ -239,6 +239,28 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout);
 void osd_work_queue_free(osd_work_queue *queue);
 
 
+/*-----------------------------------------------------------------------------
+    osd_work_queue_restart_after_fork: give every live work queue fresh
+        worker threads in a child process created with fork()
+
+    Parameters:
+
+        None.
+
+    Return value:
+
+        None.
+
+    Notes:
+
+        Only the forking thread survives fork(), so without this any work
+        queued in the child would never run.  Must be called in the child
+        before it queues any work, and only when no items were pending at
+        the time of the fork.
+-----------------------------------------------------------------------------*/
+void osd_work_queue_restart_after_fork();
+
+
 /*-----------------------------------------------------------------------------
     osd_work_item_queue_multiple: queue a set of work items
 
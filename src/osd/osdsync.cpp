@@ -21,6 +21,7 @@
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <new>
 // MAME headers
 #include "osdcore.h"
 #include "osdsync.h"
@@ -207,6 +208,10 @@ struct osd_work_item
 
 int osd_num_processors = 0;
 
+// live queues, so threads can be recreated after fork()
+static std::mutex s_queue_list_lock;
+static std::vector<osd_work_queue *> s_queue_list;
+
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
@@ -319,6 +324,11 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	{
 		begin_timing(queue->thread[queue->threads]->waittime);
 	}
+
+	{
+		std::lock_guard<std::mutex> lock(s_queue_list_lock);
+		s_queue_list.push_back(queue);
+	}
 	return queue;
 
 error:
@@ -394,6 +404,11 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 
 void osd_work_queue_free(osd_work_queue *queue)
 {
+	{
+		std::lock_guard<std::mutex> lock(s_queue_list_lock);
+		s_queue_list.erase(std::remove(s_queue_list.begin(), s_queue_list.end(), queue), s_queue_list.end());
+	}
+
 	// stop the timer for "waittime" on the main thread
 	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
 	{
@@ -472,6 +487,41 @@ void osd_work_queue_free(osd_work_queue *queue)
 }
 
 
+//============================================================
+//  osd_work_queue_restart_after_fork
+//============================================================
+
+void osd_work_queue_restart_after_fork()
+{
+	// the lock may have been held by a thread that no longer exists
+	new (&s_queue_list_lock) std::mutex();
+
+	for (osd_work_queue *queue : s_queue_list)
+	{
+		// the same goes for the queue's own synchronisation state
+		new (&queue->lock) std::mutex();
+		new (&queue->doneevent) osd_event(true, true);
+		queue->livethreads = 0;
+		queue->waiting = 0;
+
+		for (uint32_t threadnum = 0; threadnum < queue->threads; threadnum++)
+		{
+			work_thread_info *thread = queue->thread[threadnum];
+
+			// the old handle refers to a thread that doesn't exist here and can
+			// neither be joined nor destroyed, so it is deliberately leaked
+			new (&thread->wakeevent) osd_event(false, false);
+			thread->active = 0;
+			thread->handle = new std::thread(worker_thread_entry, thread);
+			if (queue->flags & WORK_QUEUE_FLAG_IO)
+				thread_adjust_priority(thread->handle, 1);
+			else
+				thread_adjust_priority(thread->handle, 0);
+		}
+	}
+}
+
+
 //============================================================
 //  osd_work_item_queue_multiple
 //============================================================
@@ -108,6 +108,8 @@ bool emulator_info::frame_hook() { return false; }
 
 void emulator_info::sound_hook() { }
 
+void emulator_info::state_saved_hook(const char *filename, bool success) { }
+
 void emulator_info::layout_script_cb(layout_file &file, const char *script) { }
 
 const char * emulator_info::get_appname() { return nullptr; }
@@ -0,0 +1,52 @@
+#include "catch.hpp"
+
+#include "emucore.h"
+#include "timerheap.h"
+
+#include <vector>
+
+namespace {
+
+struct heap_entry
+{
+	u32 heap_index = 0;
+	u32 key = 0;
+	u32 sequence = 0;
+};
+
+struct heap_entry_traits
+{
+	static bool precedes(const heap_entry &a, const heap_entry &b) { return (a.key < b.key) || ((a.key == b.key) && (a.sequence < b.sequence)); }
+	static u32 &heap_index(heap_entry &entry) { return entry.heap_index; }
+};
+
+} // anonymous namespace
+
+TEST_CASE("timer heap returns entries in order", "[emu]")
+{
+	std::vector<heap_entry> entries(64);
+	timer_heap<heap_entry, heap_entry_traits> heap;
+	for (u32 i = 0; i < entries.size(); i++)
+	{
+		entries[i].key = (i * 37) % 16;
+		entries[i].sequence = i;
+		heap.insert(entries[i]);
+	}
+
+	// remove one from the middle; the rest must still come out in order
+	heap.remove(entries[20]);
+
+	heap_entry const *previous = nullptr;
+	u32 count = 0;
+	while (!heap.empty())
+	{
+		heap_entry &entry = *heap.front();
+		REQUIRE(&entry != &entries[20]);
+		if (previous)
+			REQUIRE(heap_entry_traits::precedes(*previous, entry));
+		heap.remove(entry);
+		previous = &entry;
+		count++;
+	}
+	REQUIRE(count == entries.size() - 1);
+}